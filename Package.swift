@@ -182,6 +182,8 @@ let package = Package(
         "src/core/ext/filters/http/client_authority_filter.cc",
         "src/core/ext/filters/http/client_authority_filter.h",
         "src/core/ext/filters/http/http_filters_plugin.cc",
+        "src/core/ext/filters/http/message_compress/adaptive_compression.cc",
+        "src/core/ext/filters/http/message_compress/adaptive_compression.h",
         "src/core/ext/filters/http/message_compress/compression_filter.cc",
         "src/core/ext/filters/http/message_compress/compression_filter.h",
         "src/core/ext/filters/http/server/http_server_filter.cc",
@@ -210,7 +212,9 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/chttp2_transport.h",
         "src/core/ext/transport/chttp2/transport/context_list_entry.h",
         "src/core/ext/transport/chttp2/transport/decode_huff.cc",
+        "src/core/ext/transport/chttp2/transport/decode_huff_multisym.cc",
         "src/core/ext/transport/chttp2/transport/decode_huff.h",
+        "src/core/ext/transport/chttp2/transport/decode_huff_multisym.h",
         "src/core/ext/transport/chttp2/transport/flow_control.cc",
         "src/core/ext/transport/chttp2/transport/flow_control.h",
         "src/core/ext/transport/chttp2/transport/frame.cc",
@@ -1156,8 +1160,12 @@ let package = Package(
         "src/core/lib/event_engine/nameser.h",
         "src/core/lib/event_engine/poller.h",
         "src/core/lib/event_engine/posix.h",
+        "src/core/lib/event_engine/posix_engine/busy_poll.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
+        "src/core/lib/event_engine/posix_engine/busy_poll.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1184,7 +1192,9 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer.cc",
         "src/core/lib/event_engine/posix_engine/timer.h",
         "src/core/lib/event_engine/posix_engine/timer_heap.cc",
+        "src/core/lib/event_engine/posix_engine/timing_wheel.cc",
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
+        "src/core/lib/event_engine/posix_engine/timing_wheel.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
@@ -1210,7 +1220,9 @@ let package = Package(
         "src/core/lib/event_engine/thread_local.h",
         "src/core/lib/event_engine/thread_pool/thread_count.cc",
         "src/core/lib/event_engine/thread_pool/thread_count.h",
+        "src/core/lib/event_engine/thread_pool/numa_topology.h",
         "src/core/lib/event_engine/thread_pool/thread_pool.h",
+        "src/core/lib/event_engine/thread_pool/numa_topology.cc",
         "src/core/lib/event_engine/thread_pool/thread_pool_factory.cc",
         "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc",
         "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h",
@@ -1631,7 +1643,9 @@ let package = Package(
         "src/core/lib/security/transport/server_auth_filter.cc",
         "src/core/lib/security/util/json_util.cc",
         "src/core/lib/security/util/json_util.h",
+        "src/core/lib/slice/interned_slice.cc",
         "src/core/lib/slice/percent_encoding.cc",
+        "src/core/lib/slice/interned_slice.h",
         "src/core/lib/slice/percent_encoding.h",
         "src/core/lib/slice/slice.cc",
         "src/core/lib/slice/slice.h",
@@ -1761,7 +1775,11 @@ let package = Package(
         "src/core/load_balancing/pick_first/pick_first.cc",
         "src/core/load_balancing/pick_first/pick_first.h",
         "src/core/load_balancing/priority/priority.cc",
+        "src/core/load_balancing/ring_hash/ketama_ring.cc",
+        "src/core/load_balancing/ring_hash/maglev_table.cc",
         "src/core/load_balancing/ring_hash/ring_hash.cc",
+        "src/core/load_balancing/ring_hash/ketama_ring.h",
+        "src/core/load_balancing/ring_hash/maglev_table.h",
         "src/core/load_balancing/ring_hash/ring_hash.h",
         "src/core/load_balancing/rls/rls.cc",
         "src/core/load_balancing/rls/rls.h",
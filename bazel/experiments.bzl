@@ -24,6 +24,7 @@ EXPERIMENT_ENABLES = {
     "event_engine_dns": "event_engine_dns",
     "event_engine_listener": "event_engine_listener",
     "free_large_allocator": "free_large_allocator",
+    "hpack_multisym_huffman_decoder": "hpack_multisym_huffman_decoder",
     "max_pings_wo_data_throttle": "max_pings_wo_data_throttle",
     "monitoring_experiment": "monitoring_experiment",
     "multiping": "multiping",
@@ -31,6 +32,7 @@ EXPERIMENT_ENABLES = {
     "promise_based_inproc_transport": "promise_based_inproc_transport",
     "schedule_cancellation_over_write": "schedule_cancellation_over_write",
     "server_privacy": "server_privacy",
+    "stream_compression": "stream_compression",
     "tcp_frame_size_tuning": "tcp_frame_size_tuning",
     "tcp_rcv_lowat": "tcp_rcv_lowat",
     "trace_record_callops": "trace_record_callops",
@@ -50,6 +52,9 @@ EXPERIMENTS = {
         "dbg": {
         },
         "off": {
+            "compression_test": [
+                "stream_compression",
+            ],
             "endpoint_test": [
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
@@ -59,6 +64,9 @@ EXPERIMENTS = {
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_multisym_huffman_decoder",
+            ],
             "resource_quota_test": [
                 "free_large_allocator",
                 "unconstrained_max_quota_buffer_size",
@@ -96,6 +104,9 @@ EXPERIMENTS = {
         "dbg": {
         },
         "off": {
+            "compression_test": [
+                "stream_compression",
+            ],
             "endpoint_test": [
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
@@ -105,6 +116,9 @@ EXPERIMENTS = {
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_multisym_huffman_decoder",
+            ],
             "resource_quota_test": [
                 "free_large_allocator",
                 "unconstrained_max_quota_buffer_size",
@@ -126,6 +140,9 @@ EXPERIMENTS = {
         "dbg": {
         },
         "off": {
+            "compression_test": [
+                "stream_compression",
+            ],
             "core_end2end_test": [
                 "event_engine_client",
                 "work_serializer_dispatch",
@@ -145,6 +162,9 @@ EXPERIMENTS = {
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_multisym_huffman_decoder",
+            ],
             "lb_unit_test": [
                 "work_serializer_dispatch",
             ],
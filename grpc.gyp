@@ -303,6 +303,7 @@
         'src/core/ext/filters/http/client/http_client_filter.cc',
         'src/core/ext/filters/http/client_authority_filter.cc',
         'src/core/ext/filters/http/http_filters_plugin.cc',
+        'src/core/ext/filters/http/message_compress/adaptive_compression.cc',
         'src/core/ext/filters/http/message_compress/compression_filter.cc',
         'src/core/ext/filters/http/message_compress/legacy_compression_filter.cc',
         'src/core/ext/filters/http/server/http_server_filter.cc',
@@ -320,6 +321,7 @@
         'src/core/ext/transport/chttp2/transport/bin_encoder.cc',
         'src/core/ext/transport/chttp2/transport/chttp2_transport.cc',
         'src/core/ext/transport/chttp2/transport/decode_huff.cc',
+        'src/core/ext/transport/chttp2/transport/decode_huff_multisym.cc',
         'src/core/ext/transport/chttp2/transport/flow_control.cc',
         'src/core/ext/transport/chttp2/transport/frame.cc',
         'src/core/ext/transport/chttp2/transport/frame_data.cc',
@@ -728,7 +730,9 @@
         'src/core/lib/event_engine/default_event_engine_factory.cc',
         'src/core/lib/event_engine/event_engine.cc',
         'src/core/lib/event_engine/forkable.cc',
+        'src/core/lib/event_engine/posix_engine/busy_poll.cc',
         'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+        'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
         'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
         'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
         'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -741,6 +745,7 @@
         'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
+        'src/core/lib/event_engine/posix_engine/timing_wheel.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
         'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
@@ -752,6 +757,7 @@
         'src/core/lib/event_engine/slice_buffer.cc',
         'src/core/lib/event_engine/tcp_socket_utils.cc',
         'src/core/lib/event_engine/thread_pool/thread_count.cc',
+        'src/core/lib/event_engine/thread_pool/numa_topology.cc',
         'src/core/lib/event_engine/thread_pool/thread_pool_factory.cc',
         'src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc',
         'src/core/lib/event_engine/thready_event_engine/thready_event_engine.cc',
@@ -943,6 +949,7 @@
         'src/core/lib/security/transport/tsi_error.cc',
         'src/core/lib/security/util/json_util.cc',
         'src/core/lib/slice/b64.cc',
+        'src/core/lib/slice/interned_slice.cc',
         'src/core/lib/slice/percent_encoding.cc',
         'src/core/lib/slice/slice.cc',
         'src/core/lib/slice/slice_buffer.cc',
@@ -1008,6 +1015,8 @@
         'src/core/load_balancing/outlier_detection/outlier_detection.cc',
         'src/core/load_balancing/pick_first/pick_first.cc',
         'src/core/load_balancing/priority/priority.cc',
+        'src/core/load_balancing/ring_hash/ketama_ring.cc',
+        'src/core/load_balancing/ring_hash/maglev_table.cc',
         'src/core/load_balancing/ring_hash/ring_hash.cc',
         'src/core/load_balancing/rls/rls.cc',
         'src/core/load_balancing/round_robin/round_robin.cc',
@@ -1177,6 +1186,7 @@
         'src/core/ext/filters/http/client/http_client_filter.cc',
         'src/core/ext/filters/http/client_authority_filter.cc',
         'src/core/ext/filters/http/http_filters_plugin.cc',
+        'src/core/ext/filters/http/message_compress/adaptive_compression.cc',
         'src/core/ext/filters/http/message_compress/compression_filter.cc',
         'src/core/ext/filters/http/message_compress/legacy_compression_filter.cc',
         'src/core/ext/filters/http/server/http_server_filter.cc',
@@ -1187,6 +1197,7 @@
         'src/core/ext/transport/chttp2/transport/bin_encoder.cc',
         'src/core/ext/transport/chttp2/transport/chttp2_transport.cc',
         'src/core/ext/transport/chttp2/transport/decode_huff.cc',
+        'src/core/ext/transport/chttp2/transport/decode_huff_multisym.cc',
         'src/core/ext/transport/chttp2/transport/flow_control.cc',
         'src/core/ext/transport/chttp2/transport/frame.cc',
         'src/core/ext/transport/chttp2/transport/frame_data.cc',
@@ -1271,7 +1282,9 @@
         'src/core/lib/event_engine/default_event_engine_factory.cc',
         'src/core/lib/event_engine/event_engine.cc',
         'src/core/lib/event_engine/forkable.cc',
+        'src/core/lib/event_engine/posix_engine/busy_poll.cc',
         'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+        'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
         'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
         'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
         'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -1284,6 +1297,7 @@
         'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
+        'src/core/lib/event_engine/posix_engine/timing_wheel.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
         'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
@@ -1295,6 +1309,7 @@
         'src/core/lib/event_engine/slice_buffer.cc',
         'src/core/lib/event_engine/tcp_socket_utils.cc',
         'src/core/lib/event_engine/thread_pool/thread_count.cc',
+        'src/core/lib/event_engine/thread_pool/numa_topology.cc',
         'src/core/lib/event_engine/thread_pool/thread_pool_factory.cc',
         'src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc',
         'src/core/lib/event_engine/thready_event_engine/thready_event_engine.cc',
@@ -1447,6 +1462,7 @@
         'src/core/lib/security/transport/tsi_error.cc',
         'src/core/lib/security/util/json_util.cc',
         'src/core/lib/slice/b64.cc',
+        'src/core/lib/slice/interned_slice.cc',
         'src/core/lib/slice/percent_encoding.cc',
         'src/core/lib/slice/slice.cc',
         'src/core/lib/slice/slice_buffer.cc',
@@ -2080,7 +2096,9 @@
         'src/core/lib/event_engine/default_event_engine_factory.cc',
         'src/core/lib/event_engine/event_engine.cc',
         'src/core/lib/event_engine/forkable.cc',
+        'src/core/lib/event_engine/posix_engine/busy_poll.cc',
         'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+        'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
         'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
         'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
         'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -2093,6 +2111,7 @@
         'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
+        'src/core/lib/event_engine/posix_engine/timing_wheel.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
         'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
@@ -2104,6 +2123,7 @@
         'src/core/lib/event_engine/slice_buffer.cc',
         'src/core/lib/event_engine/tcp_socket_utils.cc',
         'src/core/lib/event_engine/thread_pool/thread_count.cc',
+        'src/core/lib/event_engine/thread_pool/numa_topology.cc',
         'src/core/lib/event_engine/thread_pool/thread_pool_factory.cc',
         'src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc',
         'src/core/lib/event_engine/thready_event_engine/thready_event_engine.cc',
@@ -2255,6 +2275,7 @@
         'src/core/lib/security/transport/tsi_error.cc',
         'src/core/lib/security/util/json_util.cc',
         'src/core/lib/slice/b64.cc',
+        'src/core/lib/slice/interned_slice.cc',
         'src/core/lib/slice/percent_encoding.cc',
         'src/core/lib/slice/slice.cc',
         'src/core/lib/slice/slice_buffer.cc',
@@ -81,6 +81,23 @@
 /** How much memory to use for hpack encoding. Int valued, bytes. */
 #define GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER \
   "grpc.http2.hpack_table_size.encoder"
+/** Should the hpack encoder huffman compress non-binary header values when
+    that makes them smaller? Trades encoding CPU for header bytes. Defaults to
+    off (0) */
+#define GRPC_ARG_HTTP2_HPACK_HUFFMAN_ENCODE_VALUES \
+  "grpc.http2.hpack_huffman_encode_values"
+/** How many repeated header pairs a client connection remembers for the next
+    connection to the same peer, which then indexes them in its hpack table
+    from their first use. Helps short-lived connections. Only keys listed in
+    GRPC_ARG_HTTP2_HPACK_WARM_START_KEYS are remembered. Int valued, defaults
+    to 0 (off). */
+#define GRPC_ARG_HTTP2_HPACK_WARM_START_ENTRIES \
+  "grpc.http2.hpack_warm_start_entries"
+/** Comma separated list of the header keys whose values
+    GRPC_ARG_HTTP2_HPACK_WARM_START_ENTRIES may carry over to later connections.
+    Must not include headers that may hold credentials or other secrets.
+    String valued, defaults to none. */
+#define GRPC_ARG_HTTP2_HPACK_WARM_START_KEYS "grpc.http2.hpack_warm_start_keys"
 /** How big a frame are we willing to receive via HTTP2.
     Min 16384, max 16777215. Larger values give lower CPU usage for large
     messages, but more head of line blocking for small messages. */
@@ -125,6 +142,16 @@
 /** How much data are we willing to queue up per stream if
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** How long, in microseconds, an http2 transport may hold a write for message
+    data so that writes from other streams can join it. Bounds the latency
+    added to each write. Int valued, defaults to 0 (writes are not held). */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US \
+  "grpc.http2.write_coalescing_window_us"
+/** Once this many bytes of message data are queued, a write held by
+    GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US is started without waiting for
+    the window to close. Int valued, bytes. Defaults to 64KiB. */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_BYTES \
+  "grpc.http2.write_coalescing_bytes"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -198,6 +225,19 @@
 #define GRPC_ARG_ABSOLUTE_MAX_METADATA_SIZE "grpc.absolute_max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** Number of listening sockets to open for each address a server binds to.
+ * Values greater than 1 open that many SO_REUSEPORT sockets on the same
+ * address and port, each with its own poller registration, so that the kernel
+ * spreads incoming connections across them. Requires SO_REUSEPORT to be
+ * available and allowed (see GRPC_ARG_ALLOW_REUSEPORT). Only supported by the
+ * posix EventEngine. Defaults to 1. */
+#define GRPC_ARG_TCP_LISTENER_SHARDS "grpc.experimental.tcp_listener_shards"
+/** If non-zero and GRPC_ARG_TCP_LISTENER_SHARDS is greater than 1, attach a
+ * classic BPF program to each group of listening sockets that steers an
+ * incoming connection to the socket indexed by the CPU that received it,
+ * modulo the number of sockets. Linux only. Defaults to 0. */
+#define GRPC_ARG_TCP_LISTENER_CPU_STEERING \
+  "grpc.experimental.tcp_listener_cpu_steering"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable) */
@@ -259,6 +299,16 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map page-aligned payloads directly from the socket
+   receive queue with TCP_ZEROCOPY_RECEIVE instead of copying them. Only
+   supported by the posix EventEngine on Linux. By default, it is disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy receive threshold: only attempt a zerocopy receive if at
+   least this many bytes are expected. By default, this is set to 256KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_receive_bytes_threshold"
 /* Overrides the TCP socket receive buffer size, SO_RCVBUF. */
 #define GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE "grpc.tcp_receive_buffer_size"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
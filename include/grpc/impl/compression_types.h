@@ -53,6 +53,33 @@ extern "C" {
  * be ignored). */
 #define GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET \
   "grpc.compression_enabled_algorithms_bitset"
+/** If non-zero, the messages a server sends on a call are compressed as one
+ * stream, so that each message can refer back to the earlier ones, when the
+ * client also enables it. This helps server-streaming RPCs whose messages
+ * repeat each other, at the cost of keeping compression state for the whole
+ * call. Only gzip and deflate can be streamed. Has no effect unless the
+ * stream_compression experiment is enabled. Defaults to 0. */
+#define GRPC_COMPRESSION_CHANNEL_ENABLE_STREAMING \
+  "grpc.compression_enable_streaming"
+/** If non-zero, the compression filter measures, per method, how much
+ * compression saves and how long it takes, and sends messages uncompressed
+ * for methods where the savings do not pay for the CPU time. The thresholds
+ * are set by the GRPC_COMPRESSION_CHANNEL_ADAPTIVE_* arguments below.
+ * Defaults to 0. */
+#define GRPC_COMPRESSION_CHANNEL_ADAPTIVE "grpc.compression_adaptive"
+/** Share of the bytes, in percent, that compression must save for adaptive
+ * compression to keep compressing a method. Int valued, defaults to 10. */
+#define GRPC_COMPRESSION_CHANNEL_ADAPTIVE_MIN_SAVINGS_PERCENT \
+  "grpc.compression_adaptive_min_savings_percent"
+/** Bytes that compression must save per millisecond of compression time for
+ * adaptive compression to keep compressing a method. Int valued, defaults to
+ * 4096. */
+#define GRPC_COMPRESSION_CHANNEL_ADAPTIVE_MIN_BYTES_SAVED_PER_MS \
+  "grpc.compression_adaptive_min_bytes_saved_per_ms"
+/** Size in bytes below which adaptive compression never compresses a message.
+ * Int valued, defaults to 128. */
+#define GRPC_COMPRESSION_CHANNEL_ADAPTIVE_MIN_MESSAGE_SIZE \
+  "grpc.compression_adaptive_min_message_size"
 /** \} */
 
 /** The various compression algorithms supported by gRPC (not sorted by
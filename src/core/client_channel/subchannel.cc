@@ -474,10 +474,22 @@ void Subchannel::ConnectivityStateWatcherList::NotifyLocked(
 
 namespace {
 
+constexpr WellKnownChannelArg kFixedReconnectBackoffMs(
+    "grpc.testing.fixed_reconnect_backoff_ms");
+constexpr WellKnownChannelArg kInitialReconnectBackoffMs(
+    GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS);
+constexpr WellKnownChannelArg kMinReconnectBackoffMs(
+    GRPC_ARG_MIN_RECONNECT_BACKOFF_MS);
+constexpr WellKnownChannelArg kMaxReconnectBackoffMs(
+    GRPC_ARG_MAX_RECONNECT_BACKOFF_MS);
+constexpr WellKnownChannelArg kEnableChannelz(GRPC_ARG_ENABLE_CHANNELZ);
+constexpr WellKnownChannelArg kMaxChannelTraceEventMemoryPerNode(
+    GRPC_ARG_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE);
+
 BackOff::Options ParseArgsForBackoffValues(const ChannelArgs& args,
                                            Duration* min_connect_timeout) {
   const absl::optional<Duration> fixed_reconnect_backoff =
-      args.GetDurationFromIntMillis("grpc.testing.fixed_reconnect_backoff_ms");
+      args.GetDurationFromIntMillis(kFixedReconnectBackoffMs);
   if (fixed_reconnect_backoff.has_value()) {
     const Duration backoff =
         std::max(Duration::Milliseconds(100), *fixed_reconnect_backoff);
@@ -490,17 +502,17 @@ BackOff::Options ParseArgsForBackoffValues(const ChannelArgs& args,
   }
   const Duration initial_backoff = std::max(
       Duration::Milliseconds(100),
-      args.GetDurationFromIntMillis(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS)
+      args.GetDurationFromIntMillis(kInitialReconnectBackoffMs)
           .value_or(Duration::Seconds(
               GRPC_SUBCHANNEL_INITIAL_CONNECT_BACKOFF_SECONDS)));
   *min_connect_timeout =
       std::max(Duration::Milliseconds(100),
-               args.GetDurationFromIntMillis(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS)
+               args.GetDurationFromIntMillis(kMinReconnectBackoffMs)
                    .value_or(Duration::Seconds(
                        GRPC_SUBCHANNEL_RECONNECT_MIN_TIMEOUT_SECONDS)));
   const Duration max_backoff =
       std::max(Duration::Milliseconds(100),
-               args.GetDurationFromIntMillis(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS)
+               args.GetDurationFromIntMillis(kMaxReconnectBackoffMs)
                    .value_or(Duration::Seconds(
                        GRPC_SUBCHANNEL_RECONNECT_MAX_BACKOFF_SECONDS)));
   return BackOff::Options()
@@ -545,11 +557,11 @@ Subchannel::Subchannel(SubchannelKey key,
                              .MapAddress(key_.address(), &args_)
                              .value_or(key_.address());
   // Initialize channelz.
-  const bool channelz_enabled = args_.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
-                                    .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT);
+  const bool channelz_enabled =
+      args_.GetBool(kEnableChannelz).value_or(GRPC_ENABLE_CHANNELZ_DEFAULT);
   if (channelz_enabled) {
     const size_t channel_tracer_max_memory = Clamp(
-        args_.GetInt(GRPC_ARG_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE)
+        args_.GetInt(kMaxChannelTraceEventMemoryPerNode)
             .value_or(GRPC_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE_DEFAULT),
         0, INT_MAX);
     channelz_node_ = MakeRefCounted<channelz::SubchannelNode>(
@@ -46,6 +46,11 @@ bool SubchannelKey::operator<(const SubchannelKey& other) const {
   int r = memcmp(address_.addr, other.address_.addr, address_.len);
   if (r < 0) return true;
   if (r > 0) return false;
+  // Equal args have equal hashes, so ordering by hash first is consistent
+  // and avoids walking both sets of args for most pairs of keys.
+  if (args_.hash() != other.args_.hash()) {
+    return args_.hash() < other.args_.hash();
+  }
   return args_ < other.args();
 }
 
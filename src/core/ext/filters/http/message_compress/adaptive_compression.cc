@@ -0,0 +1,102 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/http/message_compress/adaptive_compression.h"
+
+#include <algorithm>
+
+#include <grpc/impl/compression_types.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+namespace {
+// Weight of each new message in the moving averages.
+constexpr double kSampleWeight = 1.0 / 8;
+}  // namespace
+
+AdaptiveCompressionPolicy::Options
+AdaptiveCompressionPolicy::Options::FromChannelArgs(const ChannelArgs& args) {
+  Options options;
+  options.min_savings_percent = Clamp(
+      args.GetInt(GRPC_COMPRESSION_CHANNEL_ADAPTIVE_MIN_SAVINGS_PERCENT)
+          .value_or(options.min_savings_percent),
+      0, 100);
+  options.min_bytes_saved_per_ms = std::max(
+      0, args.GetInt(GRPC_COMPRESSION_CHANNEL_ADAPTIVE_MIN_BYTES_SAVED_PER_MS)
+             .value_or(static_cast<int>(options.min_bytes_saved_per_ms)));
+  options.min_message_size = std::max(
+      0, args.GetInt(GRPC_COMPRESSION_CHANNEL_ADAPTIVE_MIN_MESSAGE_SIZE)
+             .value_or(static_cast<int>(options.min_message_size)));
+  return options;
+}
+
+bool AdaptiveCompressionPolicy::Method::ShouldCompress(size_t size) {
+  if (size >= options_.min_message_size &&
+      (compressing() ||
+       skipped_.fetch_add(1, std::memory_order_relaxed) % kProbeInterval ==
+           kProbeInterval - 1)) {
+    global_stats().IncrementAdaptiveCompressionCompressedMessages();
+    return true;
+  }
+  global_stats().IncrementAdaptiveCompressionSkippedMessages();
+  return false;
+}
+
+void AdaptiveCompressionPolicy::Method::Record(size_t size,
+                                               size_t compressed_size,
+                                               gpr_timespec elapsed) {
+  if (size == 0) return;
+  const double saved =
+      compressed_size < size ? static_cast<double>(size - compressed_size) : 0;
+  const double savings = saved / size;
+  // A coarse clock can make a compression look free: count at least 1ns.
+  const double elapsed_ms =
+      std::max(static_cast<double>(elapsed.tv_sec) * 1e3 +
+                   static_cast<double>(elapsed.tv_nsec) / 1e6,
+               1e-6);
+  global_stats().IncrementAdaptiveCompressionSavingsPercent(
+      static_cast<int>(savings * 100));
+  MutexLock lock(&mu_);
+  if (!has_samples_) {
+    savings_ = savings;
+    bytes_saved_per_ms_ = saved / elapsed_ms;
+    has_samples_ = true;
+  } else {
+    savings_ += kSampleWeight * (savings - savings_);
+    bytes_saved_per_ms_ +=
+        kSampleWeight * (saved / elapsed_ms - bytes_saved_per_ms_);
+  }
+  compressing_.store(
+      savings_ * 100 >= options_.min_savings_percent &&
+          bytes_saved_per_ms_ >= options_.min_bytes_saved_per_ms,
+      std::memory_order_relaxed);
+}
+
+AdaptiveCompressionPolicy::Method* AdaptiveCompressionPolicy::GetMethod(
+    absl::string_view path) {
+  MutexLock lock(&mu_);
+  auto it = methods_.find(path);
+  if (it != methods_.end()) return it->second.get();
+  if (methods_.size() >= kMaxMethods) return &overflow_;
+  return methods_
+      .emplace(std::string(path), std::make_unique<Method>(options_))
+      .first->second.get();
+}
+
+}  // namespace grpc_core
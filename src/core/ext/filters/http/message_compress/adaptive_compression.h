@@ -0,0 +1,105 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_ADAPTIVE_COMPRESSION_H
+#define GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_ADAPTIVE_COMPRESSION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// Decides, per method, whether compressing messages pays for the CPU it costs.
+//
+// The policy measures the share of bytes that compression saves and how many
+// bytes it saves per millisecond of compression time, as moving averages over
+// the messages of each method. A method whose averages fall below either
+// threshold has its messages sent uncompressed, except for one in
+// kProbeInterval, which is compressed to check whether that still holds.
+class AdaptiveCompressionPolicy {
+ public:
+  struct Options {
+    // Share of the bytes, in percent, that compression must save.
+    int min_savings_percent = 10;
+    // Bytes that compression must save per millisecond it runs.
+    int64_t min_bytes_saved_per_ms = 4096;
+    // Messages smaller than this are never compressed.
+    size_t min_message_size = 128;
+
+    static Options FromChannelArgs(const ChannelArgs& args);
+  };
+
+  // Messages sent uncompressed between two probes of a method.
+  static constexpr uint32_t kProbeInterval = 32;
+  // Methods tracked separately; any more share one set of averages, so that
+  // clients cannot grow the table without bound.
+  static constexpr size_t kMaxMethods = 1024;
+
+  class Method {
+   public:
+    explicit Method(const Options& options) : options_(options) {}
+
+    // Whether to compress a message of 'size' bytes.
+    bool ShouldCompress(size_t size);
+    // Records that compressing a message of 'size' bytes took 'elapsed' and
+    // gave 'compressed_size' bytes. A message that did not shrink is recorded
+    // with 'compressed_size' equal to 'size'.
+    void Record(size_t size, size_t compressed_size, gpr_timespec elapsed);
+
+    bool compressing() const {
+      return compressing_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    const Options& options_;
+    std::atomic<bool> compressing_{true};
+    std::atomic<uint32_t> skipped_{0};
+    Mutex mu_;
+    bool has_samples_ ABSL_GUARDED_BY(mu_) = false;
+    double savings_ ABSL_GUARDED_BY(mu_) = 0;
+    double bytes_saved_per_ms_ ABSL_GUARDED_BY(mu_) = 0;
+  };
+
+  explicit AdaptiveCompressionPolicy(Options options)
+      : options_(options), overflow_(options_) {}
+
+  // The averages of the method at 'path'. The result lives as long as the
+  // policy.
+  Method* GetMethod(absl::string_view path);
+
+ private:
+  const Options options_;
+  Method overflow_;
+  Mutex mu_;
+  absl::flat_hash_map<std::string, std::unique_ptr<Method>> methods_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_ADAPTIVE_COMPRESSION_H
@@ -40,17 +40,20 @@
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/latch.h"
 #include "src/core/lib/promise/pipe.h"
 #include "src/core/lib/promise/prioritized_race.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/time_precise.h"
 
 namespace grpc_core {
 
@@ -72,6 +75,20 @@ const grpc_channel_filter ServerCompressionFilter::kFilter =
                                kFilterExaminesInboundMessages |
                                kFilterExaminesOutboundMessages>();
 
+namespace {
+
+MemoryAllocator CompressionMemoryAllocator(const ChannelArgs& args) {
+  ResourceQuota* resource_quota = args.GetObject<ResourceQuota>();
+  ResourceQuotaRefPtr default_quota;
+  if (resource_quota == nullptr) {
+    default_quota = ResourceQuota::Default();
+    resource_quota = default_quota.get();
+  }
+  return resource_quota->memory_quota()->CreateMemoryAllocator("compression");
+}
+
+}  // namespace
+
 absl::StatusOr<std::unique_ptr<ClientCompressionFilter>>
 ClientCompressionFilter::Create(const ChannelArgs& args, ChannelFilter::Args) {
   return std::make_unique<ClientCompressionFilter>(args);
@@ -95,7 +112,17 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION).value_or(true)),
       enable_decompression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION)
-              .value_or(true)) {
+              .value_or(true)),
+      enable_streaming_(
+          IsStreamCompressionEnabled() &&
+          args.GetBool(GRPC_COMPRESSION_CHANNEL_ENABLE_STREAMING)
+              .value_or(false)),
+      zlib_streams_(CompressionMemoryAllocator(args)),
+      adaptive_policy_(
+          args.GetBool(GRPC_COMPRESSION_CHANNEL_ADAPTIVE).value_or(false)
+              ? std::make_unique<AdaptiveCompressionPolicy>(
+                    AdaptiveCompressionPolicy::Options::FromChannelArgs(args))
+              : nullptr) {
   // Make sure the default is enabled.
   if (!enabled_compression_algorithms_.IsSet(default_compression_algorithm_)) {
     const char* name;
@@ -109,8 +136,18 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
   }
 }
 
+AdaptiveCompressionPolicy::Method* ChannelCompression::AdaptiveMethod(
+    const grpc_metadata_batch& client_initial_metadata) {
+  if (adaptive_policy_ == nullptr) return nullptr;
+  const Slice* path = client_initial_metadata.get_pointer(HttpPathMetadata());
+  return adaptive_policy_->GetMethod(path != nullptr ? path->as_string_view()
+                                                     : absl::string_view());
+}
+
 MessageHandle ChannelCompression::CompressMessage(
-    MessageHandle message, grpc_compression_algorithm algorithm) const {
+    MessageHandle message, grpc_compression_algorithm algorithm,
+    MessageStreamCompressor* stream,
+    AdaptiveCompressionPolicy::Method* adaptive_method) const {
   GRPC_TRACE_LOG(compression, INFO)
       << "CompressMessage: len=" << message->payload()->Length()
       << " alg=" << algorithm << " flags=" << message->flags();
@@ -126,11 +163,29 @@ MessageHandle ChannelCompression::CompressMessage(
       (flags & (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS))) {
     return message;
   }
+  SliceBuffer* payload = message->payload();
+  // A stream compresses every message it is given, since the peer has to see
+  // them all to follow it.
+  if (stream != nullptr) adaptive_method = nullptr;
+  if (adaptive_method != nullptr &&
+      !adaptive_method->ShouldCompress(payload->Length())) {
+    return message;
+  }
   // Try to compress the payload.
   SliceBuffer tmp;
-  SliceBuffer* payload = message->payload();
-  bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
-                                        tmp.c_slice_buffer());
+  const gpr_cycle_counter start = gpr_get_cycle_counter();
+  bool did_compress =
+      stream != nullptr
+          ? stream->Compress(payload->c_slice_buffer(), tmp.c_slice_buffer())
+          : grpc_msg_compress(algorithm, payload->c_slice_buffer(),
+                              tmp.c_slice_buffer(), &zlib_streams_);
+  if (adaptive_method != nullptr) {
+    const gpr_timespec elapsed =
+        gpr_cycle_counter_sub(gpr_get_cycle_counter(), start);
+    adaptive_method->Record(payload->Length(),
+                            did_compress ? tmp.Length() : payload->Length(),
+                            elapsed);
+  }
   // If we achieved compression send it as compressed, otherwise send it as (to
   // avoid spending cycles on the receiver decompressing).
   if (did_compress) {
@@ -164,7 +219,7 @@ MessageHandle ChannelCompression::CompressMessage(
 }
 
 absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
-    bool is_client, MessageHandle message, DecompressArgs args) const {
+    bool is_client, MessageHandle message, const DecompressArgs& args) const {
   GRPC_TRACE_LOG(compression, INFO)
       << "DecompressMessage: len=" << message->payload()->Length()
       << " max=" << args.max_recv_message_length.value_or(-1)
@@ -190,8 +245,15 @@ absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
   }
   // Try to decompress the payload.
   SliceBuffer decompressed_slices;
-  if (grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
-                          decompressed_slices.c_slice_buffer()) == 0) {
+  const bool ok =
+      args.stream != nullptr
+          ? args.stream->Decompress(message->payload()->c_slice_buffer(),
+                                    decompressed_slices.c_slice_buffer())
+          : grpc_msg_decompress(args.algorithm,
+                                message->payload()->c_slice_buffer(),
+                                decompressed_slices.c_slice_buffer(),
+                                &zlib_streams_) != 0;
+  if (!ok) {
     return absl::InternalError(
         absl::StrCat("Unexpected error decompressing data for algorithm ",
                      CompressionAlgorithmAsString(args.algorithm)));
@@ -233,24 +295,58 @@ ChannelCompression::DecompressArgs ChannelCompression::HandleIncomingMetadata(
   }
   return DecompressArgs{incoming_metadata.get(GrpcEncodingMetadata())
                             .value_or(GRPC_COMPRESS_NONE),
-                        max_recv_message_length};
+                        max_recv_message_length, nullptr};
+}
+
+void ChannelCompression::OfferStreamCompression(
+    grpc_metadata_batch& client_initial_metadata) const {
+  if (!enable_streaming_ || !enable_decompression_) return;
+  client_initial_metadata.Set(GrpcStreamCompressionMetadata(), 1);
+}
+
+void ChannelCompression::HandleStreamCompressionReply(
+    const grpc_metadata_batch& server_initial_metadata,
+    DecompressArgs& args) const {
+  if (!enable_streaming_ || !enable_decompression_ ||
+      server_initial_metadata.get(GrpcStreamCompressionMetadata()) != 1) {
+    return;
+  }
+  // If this fails, the messages fail to decompress one by one instead.
+  args.stream =
+      MessageStreamDecompressor::Create(args.algorithm, &zlib_streams_);
+}
+
+std::unique_ptr<MessageStreamCompressor>
+ChannelCompression::MaybeAcceptStreamCompression(
+    bool offered, grpc_compression_algorithm algorithm,
+    grpc_metadata_batch& server_initial_metadata) const {
+  if (!offered || !enable_streaming_ || !enable_compression_) return nullptr;
+  auto stream = MessageStreamCompressor::Create(algorithm, &zlib_streams_);
+  if (stream != nullptr) {
+    server_initial_metadata.Set(GrpcStreamCompressionMetadata(), 1);
+  }
+  return stream;
 }
 
 void ClientCompressionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, ClientCompressionFilter* filter) {
   compression_algorithm_ =
       filter->compression_engine_.HandleOutgoingMetadata(md);
+  filter->compression_engine_.OfferStreamCompression(md);
+  adaptive_method_ = filter->compression_engine_.AdaptiveMethod(md);
 }
 
 MessageHandle ClientCompressionFilter::Call::OnClientToServerMessage(
     MessageHandle message, ClientCompressionFilter* filter) {
-  return filter->compression_engine_.CompressMessage(std::move(message),
-                                                     compression_algorithm_);
+  return filter->compression_engine_.CompressMessage(
+      std::move(message), compression_algorithm_, nullptr, adaptive_method_);
 }
 
 void ClientCompressionFilter::Call::OnServerInitialMetadata(
     ServerMetadata& md, ClientCompressionFilter* filter) {
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
+  filter->compression_engine_.HandleStreamCompressionReply(md,
+                                                           decompress_args_);
 }
 
 absl::StatusOr<MessageHandle>
@@ -263,6 +359,8 @@ ClientCompressionFilter::Call::OnServerToClientMessage(
 void ServerCompressionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, ServerCompressionFilter* filter) {
   decompress_args_ = filter->compression_engine_.HandleIncomingMetadata(md);
+  stream_compression_offered_ = md.get(GrpcStreamCompressionMetadata()) == 1;
+  adaptive_method_ = filter->compression_engine_.AdaptiveMethod(md);
 }
 
 absl::StatusOr<MessageHandle>
@@ -276,12 +374,15 @@ void ServerCompressionFilter::Call::OnServerInitialMetadata(
     ServerMetadata& md, ServerCompressionFilter* filter) {
   compression_algorithm_ =
       filter->compression_engine_.HandleOutgoingMetadata(md);
+  stream_compressor_ = filter->compression_engine_.MaybeAcceptStreamCompression(
+      stream_compression_offered_, compression_algorithm_, md);
 }
 
 MessageHandle ServerCompressionFilter::Call::OnServerToClientMessage(
     MessageHandle message, ServerCompressionFilter* filter) {
-  return filter->compression_engine_.CompressMessage(std::move(message),
-                                                     compression_algorithm_);
+  return filter->compression_engine_.CompressMessage(
+      std::move(message), compression_algorithm_, stream_compressor_.get(),
+      adaptive_method_);
 }
 
 }  // namespace grpc_core
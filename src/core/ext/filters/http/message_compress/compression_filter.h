@@ -24,16 +24,20 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <memory>
+
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 #include <grpc/impl/compression_types.h>
 
+#include "src/core/ext/filters/http/message_compress/adaptive_compression.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
@@ -61,6 +65,16 @@ namespace grpc_core {
 /// to incorporate GRPC_WRITE_INTERNAL_COMPRESS. Otherwise, and regardless of
 /// the aforementioned 'grpc-encoding' metadata value, data will pass through
 /// uncompressed.
+///
+/// If GRPC_COMPRESSION_CHANNEL_ENABLE_STREAMING is set on both sides and the
+/// stream_compression experiment is enabled, the server compresses its
+/// messages on a call as one stream rather than one by one. The client offers
+/// this in its initial metadata and the server accepts it in its own, both
+/// under the 'grpc-stream-compression' key.
+///
+/// If GRPC_COMPRESSION_CHANNEL_ADAPTIVE is set, messages that are not
+/// compressed as a stream go through an AdaptiveCompressionPolicy, which skips
+/// compression for methods where it does not pay for its CPU time.
 
 class ChannelCompression {
  public:
@@ -69,6 +83,8 @@ class ChannelCompression {
   struct DecompressArgs {
     grpc_compression_algorithm algorithm;
     absl::optional<uint32_t> max_recv_message_length;
+    // Set if the peer compresses its messages as one stream.
+    std::unique_ptr<MessageStreamDecompressor> stream;
   };
 
   grpc_compression_algorithm default_compression_algorithm() const {
@@ -84,13 +100,33 @@ class ChannelCompression {
   DecompressArgs HandleIncomingMetadata(
       const grpc_metadata_batch& incoming_metadata);
 
-  // Compress one message synchronously.
-  MessageHandle CompressMessage(MessageHandle message,
-                                grpc_compression_algorithm algorithm) const;
+  // Client side of stream compression: offer it, then see whether the server
+  // took it up for the algorithm in args.
+  void OfferStreamCompression(
+      grpc_metadata_batch& client_initial_metadata) const;
+  void HandleStreamCompressionReply(
+      const grpc_metadata_batch& server_initial_metadata,
+      DecompressArgs& args) const;
+  // Server side: returns the compressor for this call's messages, after
+  // saying so in server_initial_metadata, or nullptr if not streaming.
+  std::unique_ptr<MessageStreamCompressor> MaybeAcceptStreamCompression(
+      bool offered, grpc_compression_algorithm algorithm,
+      grpc_metadata_batch& server_initial_metadata) const;
+
+  // The adaptive compression averages of the call's method, or nullptr if
+  // adaptive compression is disabled.
+  AdaptiveCompressionPolicy::Method* AdaptiveMethod(
+      const grpc_metadata_batch& client_initial_metadata);
+
+  // Compress one message synchronously, through 'stream' if set, else as
+  // 'adaptive_method' decides if set.
+  MessageHandle CompressMessage(
+      MessageHandle message, grpc_compression_algorithm algorithm,
+      MessageStreamCompressor* stream = nullptr,
+      AdaptiveCompressionPolicy::Method* adaptive_method = nullptr) const;
   // Decompress one message synchronously.
-  absl::StatusOr<MessageHandle> DecompressMessage(bool is_client,
-                                                  MessageHandle message,
-                                                  DecompressArgs args) const;
+  absl::StatusOr<MessageHandle> DecompressMessage(
+      bool is_client, MessageHandle message, const DecompressArgs& args) const;
 
  private:
   // Max receive message length, if set.
@@ -104,6 +140,12 @@ class ChannelCompression {
   bool enable_compression_;
   // Is decompression enabled?
   bool enable_decompression_;
+  // Is stream compression of server messages enabled?
+  bool enable_streaming_;
+  // zlib streams, charged to the channel's resource quota.
+  mutable ZlibStreamPool zlib_streams_;
+  // Adaptive compression, if enabled.
+  std::unique_ptr<AdaptiveCompressionPolicy> adaptive_policy_;
 };
 
 class ClientCompressionFilter final
@@ -139,6 +181,7 @@ class ClientCompressionFilter final
    private:
     grpc_compression_algorithm compression_algorithm_;
     ChannelCompression::DecompressArgs decompress_args_;
+    AdaptiveCompressionPolicy::Method* adaptive_method_ = nullptr;
   };
 
  private:
@@ -178,6 +221,9 @@ class ServerCompressionFilter final
    private:
     ChannelCompression::DecompressArgs decompress_args_;
     grpc_compression_algorithm compression_algorithm_;
+    bool stream_compression_offered_ = false;
+    std::unique_ptr<MessageStreamCompressor> stream_compressor_;
+    AdaptiveCompressionPolicy::Method* adaptive_method_ = nullptr;
   };
 
  private:
@@ -15,11 +15,19 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CHAOTIC_GOOD_TRANSPORT_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CHAOTIC_GOOD_TRANSPORT_H
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
+#include <vector>
 
+#include "absl/container/inlined_vector.h"
+#include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/optional.h"
 
 #include <grpc/support/port_platform.h>
 
@@ -29,27 +37,152 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/try_join.h"
 #include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 
+// Number of data connections a client asks for (default 1), or the most a
+// server accepts (default kMaxDataLanes).
+#define GRPC_ARG_CHAOTIC_GOOD_DATA_LANES "grpc.chaotic_good.data_lanes"
+
 namespace grpc_core {
 namespace chaotic_good {
 
+// Most data connections one transport stripes messages across.
+constexpr uint32_t kMaxDataLanes = 16;
+
+// Lays out the data plane bytes of successive frames over the data
+// connections ("lanes") of a transport. Payloads smaller than two stripes go
+// whole to one lane, picked round robin; larger ones are cut into up to one
+// stripe per kMinStripeBytes, so that a single stream is not limited to the
+// throughput of one TCP flow. The reader and the writer plan the same frames
+// in the same order, so they agree on the layout without extra signaling.
+class DataLanePlanner {
+ public:
+  static constexpr size_t kMinStripeBytes = 64 * 1024;
+  // Stripes other than the last of a payload are a multiple of this, which
+  // keeps every lane at the receiver's memory alignment.
+  static constexpr size_t kStripeGranularity = 4096;
+
+  struct Stripe {
+    size_t lane;
+    size_t length;
+  };
+  using Stripes = absl::InlinedVector<Stripe, 4>;
+
+  explicit DataLanePlanner(size_t num_lanes) : num_lanes_(num_lanes) {
+    CHECK_GE(num_lanes_, 1u);
+    CHECK_LE(num_lanes_, kMaxDataLanes);
+  }
+
+  Stripes Plan(size_t length) {
+    Stripes stripes;
+    if (length == 0) return stripes;
+    const size_t num_stripes =
+        std::max<size_t>(1, std::min(num_lanes_, length / kMinStripeBytes));
+    const size_t stripe_length =
+        (length / num_stripes + kStripeGranularity - 1) / kStripeGranularity *
+        kStripeGranularity;
+    while (length > 0) {
+      const size_t n = std::min(length, stripe_length);
+      stripes.push_back(Stripe{next_lane_, n});
+      next_lane_ = (next_lane_ + 1) % num_lanes_;
+      length -= n;
+    }
+    return stripes;
+  }
+
+ private:
+  const size_t num_lanes_;
+  size_t next_lane_ = 0;
+};
+
+// Starts writing each stripe of `data` to its lane; the returned promise
+// resolves once all of them are written.
+inline auto WriteDataLanes(std::vector<PromiseEndpoint>& lanes,
+                           DataLanePlanner& planner, SliceBuffer data) {
+  using LaneWrite =
+      decltype(std::declval<PromiseEndpoint>().Write(SliceBuffer()));
+  std::vector<LaneWrite> writes;
+  for (const auto& stripe : planner.Plan(data.Length())) {
+    SliceBuffer piece;
+    data.MoveFirstNBytesIntoSliceBuffer(stripe.length, piece);
+    writes.push_back(lanes[stripe.lane].Write(std::move(piece)));
+  }
+  const size_t num_writes = writes.size();
+  return [writes = std::move(writes),
+          done = std::vector<bool>(num_writes)]() mutable
+         -> Poll<absl::Status> {
+    bool pending = false;
+    for (size_t i = 0; i < writes.size(); ++i) {
+      if (done[i]) continue;
+      auto p = writes[i]();
+      if (auto* status = p.value_if_ready()) {
+        if (!status->ok()) return std::move(*status);
+        done[i] = true;
+      } else {
+        pending = true;
+      }
+    }
+    if (pending) return Pending{};
+    return absl::OkStatus();
+  };
+}
+
+// Starts reading each stripe of `length` data plane bytes from its lane; the
+// returned promise resolves to the stripes reassembled in order.
+inline auto ReadDataLanes(std::vector<PromiseEndpoint>& lanes,
+                          DataLanePlanner& planner, size_t length) {
+  using LaneRead = decltype(std::declval<PromiseEndpoint>().Read(0));
+  std::vector<LaneRead> reads;
+  for (const auto& stripe : planner.Plan(length)) {
+    reads.push_back(lanes[stripe.lane].Read(stripe.length));
+  }
+  const size_t num_reads = reads.size();
+  return [reads = std::move(reads),
+          pieces = std::vector<absl::optional<SliceBuffer>>(num_reads)]()
+      mutable -> Poll<absl::StatusOr<SliceBuffer>> {
+    bool pending = false;
+    for (size_t i = 0; i < reads.size(); ++i) {
+      if (pieces[i].has_value()) continue;
+      auto p = reads[i]();
+      if (auto* piece = p.value_if_ready()) {
+        if (!piece->ok()) return std::move(piece->status());
+        pieces[i] = std::move(**piece);
+      } else {
+        pending = true;
+      }
+    }
+    if (pending) return Pending{};
+    SliceBuffer data;
+    for (auto& piece : pieces) {
+      piece->MoveFirstNBytesIntoSliceBuffer(piece->Length(), data);
+    }
+    return data;
+  };
+}
+
 class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
  public:
   ChaoticGoodTransport(PromiseEndpoint control_endpoint,
-                       PromiseEndpoint data_endpoint, HPackParser hpack_parser,
-                       HPackCompressor hpack_encoder)
+                       std::vector<PromiseEndpoint> data_endpoints,
+                       HPackParser hpack_parser, HPackCompressor hpack_encoder)
       : control_endpoint_(std::move(control_endpoint)),
-        data_endpoint_(std::move(data_endpoint)),
+        data_endpoints_(std::move(data_endpoints)),
         encoder_(std::move(hpack_encoder)),
-        parser_(std::move(hpack_parser)) {
+        parser_(std::move(hpack_parser)),
+        write_planner_(data_endpoints_.size()),
+        read_planner_(data_endpoints_.size()) {
     // Enable RxMemoryAlignment and RPC receive coalescing after the transport
     // setup is complete. At this point all the settings frames should have
     // been read.
-    data_endpoint_.EnforceRxMemoryAlignmentAndCoalescing();
+    for (auto& data_endpoint : data_endpoints_) {
+      data_endpoint.EnforceRxMemoryAlignmentAndCoalescing();
+    }
   }
 
   auto WriteFrame(const FrameInterface& frame) {
@@ -63,7 +196,8 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
         << " " << frame.ToString();
     return TryJoin<absl::StatusOr>(
         control_endpoint_.Write(std::move(buffers.control)),
-        data_endpoint_.Write(std::move(buffers.data)));
+        WriteDataLanes(data_endpoints_, write_planner_,
+                       std::move(buffers.data)));
   }
 
   // Read frame header and payloads for control and data portions of one frame.
@@ -92,7 +226,8 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
                 return Map(
                     TryJoin<absl::StatusOr>(
                         control_endpoint_.Read(frame_header->GetFrameLength()),
-                        data_endpoint_.Read(message_length + message_padding)),
+                        ReadDataLanes(data_endpoints_, read_planner_,
+                                      message_length + message_padding)),
                     [frame_header = *frame_header, message_padding](
                         absl::StatusOr<std::tuple<SliceBuffer, SliceBuffer>>
                             buffers)
@@ -130,12 +265,22 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
 
  private:
   PromiseEndpoint control_endpoint_;
-  PromiseEndpoint data_endpoint_;
+  std::vector<PromiseEndpoint> data_endpoints_;
   HPackCompressor encoder_;
   HPackParser parser_;
   absl::BitGen bitgen_;
+  DataLanePlanner write_planner_;
+  DataLanePlanner read_planner_;
 };
 
+// Data endpoints for a transport with a single data connection.
+inline std::vector<PromiseEndpoint> SingleDataLane(
+    PromiseEndpoint data_endpoint) {
+  std::vector<PromiseEndpoint> data_endpoints;
+  data_endpoints.push_back(std::move(data_endpoint));
+  return data_endpoints;
+}
+
 }  // namespace chaotic_good
 }  // namespace grpc_core
 
@@ -14,6 +14,7 @@
 
 #include "src/core/ext/transport/chaotic_good/client/chaotic_good_connector.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -53,6 +54,7 @@
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/event_engine_wakeup_scheduler.h"
 #include "src/core/lib/promise/latch.h"
+#include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
@@ -65,6 +67,7 @@
 #include "src/core/lib/surface/channel_create.h"
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/promise_endpoint.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -127,11 +130,13 @@ auto ChaoticGoodConnector::DataEndpointWriteSettingsFrame(
 
 auto ChaoticGoodConnector::WaitForDataEndpointSetup(
     RefCountedPtr<ChaoticGoodConnector> self) {
+  auto data_endpoint_ready = std::make_shared<InterActivityLatch<void>>();
   // Data endpoint on_connect callback.
   grpc_event_engine::experimental::EventEngine::OnConnectCallback
       on_data_endpoint_connect =
-          [self](absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
-                     endpoint) mutable {
+          [self, data_endpoint_ready](
+              absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
+                  endpoint) mutable {
             ExecCtx exec_ctx;
             if (!endpoint.ok() || self->handshake_mgr_ == nullptr) {
               ExecCtx::Run(DEBUG_LOCATION,
@@ -149,7 +154,7 @@ auto ChaoticGoodConnector::WaitForDataEndpointSetup(
             }
             self->data_endpoint_ =
                 PromiseEndpoint(std::move(endpoint.value()), SliceBuffer());
-            self->data_endpoint_ready_.Set();
+            data_endpoint_ready->Set();
           };
   self->event_engine_->Connect(
       std::move(on_data_endpoint_connect), *self->resolved_addr_,
@@ -160,11 +165,15 @@ auto ChaoticGoodConnector::WaitForDataEndpointSetup(
       std::chrono::seconds(kTimeoutSecs));
 
   return TrySeq(Race(
-      TrySeq(self->data_endpoint_ready_.Wait(),
-             [self]() mutable {
+      TrySeq(data_endpoint_ready->Wait(),
+             [self, data_endpoint_ready]() mutable {
                return TrySeq(DataEndpointWriteSettingsFrame(self),
                              DataEndpointReadSettingsFrame(self),
-                             []() -> absl::Status { return absl::OkStatus(); });
+                             [self]() -> absl::Status {
+                               self->data_endpoints_.push_back(
+                                   std::move(self->data_endpoint_));
+                               return absl::OkStatus();
+                             });
              }),
       TrySeq(Sleep(Timestamp::Now() + Duration::Seconds(kTimeoutSecs)),
              []() -> absl::Status {
@@ -173,6 +182,21 @@ auto ChaoticGoodConnector::WaitForDataEndpointSetup(
              })));
 }
 
+auto ChaoticGoodConnector::WaitForDataEndpointsSetup(
+    RefCountedPtr<ChaoticGoodConnector> self) {
+  // Data endpoints are set up one after the other, so that the server sees
+  // them in the order the transports stripe data across them.
+  return Loop([self]() {
+    return TrySeq(WaitForDataEndpointSetup(self),
+                  [self]() -> LoopCtl<absl::Status> {
+                    if (self->data_endpoints_.size() < self->data_lanes_) {
+                      return Continue{};
+                    }
+                    return absl::OkStatus();
+                  });
+  });
+}
+
 auto ChaoticGoodConnector::ControlEndpointReadSettingsFrame(
     RefCountedPtr<ChaoticGoodConnector> self) {
   return TrySeq(
@@ -207,9 +231,12 @@ auto ChaoticGoodConnector::ControlEndpointReadSettingsFrame(
                         "no connection id in settings frame");
                   }
                   self->connection_id_ = *settings_metadata->connection_id;
+                  self->data_lanes_ =
+                      std::min(self->data_lanes_,
+                               settings_metadata->data_lanes.value_or(1));
                   return absl::OkStatus();
                 },
-                WaitForDataEndpointSetup(self)),
+                WaitForDataEndpointsSetup(self)),
             [status = frame_header.status()]() { return status; });
       });
 }
@@ -219,9 +246,10 @@ auto ChaoticGoodConnector::ControlEndpointWriteSettingsFrame(
   // Serialize setting frame.
   SettingsFrame frame;
   // frame.header set connectiion_type: control
-  frame.headers = SettingsMetadata{SettingsMetadata::ConnectionType::kControl,
-                                   absl::nullopt, absl::nullopt}
-                      .ToMetadataBatch();
+  SettingsMetadata settings{SettingsMetadata::ConnectionType::kControl,
+                            absl::nullopt, absl::nullopt};
+  if (self->data_lanes_ > 1) settings.data_lanes = self->data_lanes_;
+  frame.headers = settings.ToMetadataBatch();
   bool saw_encoding_errors = false;
   auto write_buffer =
       frame.Serialize(&self->hpack_compressor_, saw_encoding_errors);
@@ -243,6 +271,9 @@ void ChaoticGoodConnector::Connect(const Args& args, Result* result,
   }
   args_ = args;
   notify_ = notify;
+  data_lanes_ = Clamp<uint32_t>(
+      args_.channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_DATA_LANES).value_or(1),
+      1, kMaxDataLanes);
   resolved_addr_ = EventEngine::ResolvedAddress(
       reinterpret_cast<const sockaddr*>(args_.address->addr),
       args_.address->len);
@@ -324,7 +355,7 @@ void ChaoticGoodConnector::OnHandshakeDone(
             MutexLock lock(&self->mu_);
             self->result_->transport = new ChaoticGoodClientTransport(
                 std::move(self->control_endpoint_),
-                std::move(self->data_endpoint_), self->args_.channel_args,
+                std::move(self->data_endpoints_), self->args_.channel_args,
                 self->event_engine_, std::move(self->hpack_parser_),
                 std::move(self->hpack_compressor_));
             self->result_->channel_args = self->args_.channel_args;
@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "absl/random/random.h"
 #include "absl/status/statusor.h"
@@ -77,6 +78,8 @@ class ChaoticGoodConnector : public SubchannelConnector {
       RefCountedPtr<ChaoticGoodConnector> self);
   static auto WaitForDataEndpointSetup(
       RefCountedPtr<ChaoticGoodConnector> self);
+  static auto WaitForDataEndpointsSetup(
+      RefCountedPtr<ChaoticGoodConnector> self);
   void OnHandshakeDone(absl::StatusOr<HandshakerArgs*> result);
 
   RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
@@ -89,7 +92,11 @@ class ChaoticGoodConnector : public SubchannelConnector {
       resolved_addr_;
 
   PromiseEndpoint control_endpoint_;
+  // Data endpoint being set up, and those already set up.
   PromiseEndpoint data_endpoint_;
+  std::vector<PromiseEndpoint> data_endpoints_;
+  // Number of data endpoints to set up.
+  uint32_t data_lanes_ = 1;
   ActivityPtr connect_activity_ ABSL_GUARDED_BY(mu_);
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
@@ -97,7 +104,6 @@ class ChaoticGoodConnector : public SubchannelConnector {
   HPackCompressor hpack_compressor_;
   HPackParser hpack_parser_;
   absl::BitGen bitgen_;
-  InterActivityLatch<void> data_endpoint_ready_;
   std::string connection_id_;
 };
 }  // namespace chaotic_good
@@ -204,12 +204,22 @@ ChaoticGoodClientTransport::ChaoticGoodClientTransport(
     const ChannelArgs& args,
     std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
     HPackParser hpack_parser, HPackCompressor hpack_encoder)
+    : ChaoticGoodClientTransport(
+          std::move(control_endpoint), SingleDataLane(std::move(data_endpoint)),
+          args, std::move(event_engine), std::move(hpack_parser),
+          std::move(hpack_encoder)) {}
+
+ChaoticGoodClientTransport::ChaoticGoodClientTransport(
+    PromiseEndpoint control_endpoint,
+    std::vector<PromiseEndpoint> data_endpoints, const ChannelArgs& args,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
+    HPackParser hpack_parser, HPackCompressor hpack_encoder)
     : allocator_(args.GetObject<ResourceQuota>()
                      ->memory_quota()
                      ->CreateMemoryAllocator("chaotic-good")),
       outgoing_frames_(4) {
   auto transport = MakeRefCounted<ChaoticGoodTransport>(
-      std::move(control_endpoint), std::move(data_endpoint),
+      std::move(control_endpoint), std::move(data_endpoints),
       std::move(hpack_parser), std::move(hpack_encoder));
   writer_ = MakeActivity(
       // Continuously write next outgoing frames to promise endpoints.
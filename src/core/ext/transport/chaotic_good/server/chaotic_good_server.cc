@@ -14,6 +14,7 @@
 
 #include "src/core/ext/transport/chaotic_good/server/chaotic_good_server.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <random>
@@ -32,6 +33,7 @@
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/ext/transport/chaotic_good/chaotic_good_transport.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
 #include "src/core/ext/transport/chaotic_good/server_transport.h"
@@ -56,6 +58,7 @@
 #include "src/core/lib/promise/event_engine_wakeup_scheduler.h"
 #include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/latch.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
@@ -68,6 +71,7 @@
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/server/server.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -174,7 +178,8 @@ void ChaoticGoodServerListener::ActiveConnection::Orphan() {
   Unref();
 }
 
-void ChaoticGoodServerListener::ActiveConnection::NewConnectionID() {
+void ChaoticGoodServerListener::ActiveConnection::NewConnectionID(
+    uint32_t data_lanes) {
   bool has_new_id = false;
   MutexLock lock(&listener_->mu_);
   while (!has_new_id) {
@@ -184,7 +189,7 @@ void ChaoticGoodServerListener::ActiveConnection::NewConnectionID() {
     }
   }
   listener_->connectivity_map_.emplace(
-      connection_id_, std::make_shared<InterActivityLatch<PromiseEndpoint>>());
+      connection_id_, std::make_shared<DataEndpoints>(data_lanes));
 }
 
 void ChaoticGoodServerListener::ActiveConnection::Done(
@@ -256,7 +261,10 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                     const bool is_control_endpoint =
                         settings_metadata->connection_type ==
                         SettingsMetadata::ConnectionType::kControl;
-                    if (!is_control_endpoint) {
+                    if (is_control_endpoint) {
+                      self->connection_->requested_data_lanes_ =
+                          settings_metadata->data_lanes;
+                    } else {
                       if (!settings_metadata->connection_id.has_value()) {
                         return absl::UnavailableError(
                             "no connection id in data endpoint settings frame");
@@ -293,12 +301,16 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
           },
           [self]() {
             MutexLock lock(&self->connection_->listener_->mu_);
-            auto latch = self->connection_->listener_->connectivity_map_
-                             .find(self->connection_->connection_id_)
-                             ->second;
-            return latch->Wait();
+            auto data_endpoints =
+                self->connection_->listener_->connectivity_map_
+                    .find(self->connection_->connection_id_)
+                    ->second;
+            return Map(data_endpoints->ready.Wait(),
+                       [data_endpoints](std::vector<PromiseEndpoint> ret) {
+                         return ret;
+                       });
           },
-          [self](PromiseEndpoint ret) -> absl::Status {
+          [self](std::vector<PromiseEndpoint> ret) -> absl::Status {
             MutexLock lock(&self->connection_->listener_->mu_);
             GRPC_TRACE_LOG(chaotic_good, INFO)
                 << self->connection_.get()
@@ -331,12 +343,22 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
 
 auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
     ControlEndpointWriteSettingsFrame(RefCountedPtr<HandshakingState> self) {
-  self->connection_->NewConnectionID();
+  const uint32_t max_data_lanes = Clamp<uint32_t>(
+      self->connection_->args()
+          .GetInt(GRPC_ARG_CHAOTIC_GOOD_DATA_LANES)
+          .value_or(kMaxDataLanes),
+      1, kMaxDataLanes);
+  const uint32_t data_lanes = std::min(
+      self->connection_->requested_data_lanes_.value_or(1), max_data_lanes);
+  self->connection_->NewConnectionID(data_lanes);
+  SettingsMetadata settings{absl::nullopt, self->connection_->connection_id_,
+                            absl::nullopt};
+  // Only reply with a lane count to clients that know about lanes.
+  if (self->connection_->requested_data_lanes_.has_value()) {
+    settings.data_lanes = data_lanes;
+  }
   SettingsFrame frame;
-  frame.headers =
-      SettingsMetadata{absl::nullopt, self->connection_->connection_id_,
-                       absl::nullopt}
-          .ToMetadataBatch();
+  frame.headers = settings.ToMetadataBatch();
   bool saw_encoding_errors = false;
   auto write_buffer = frame.Serialize(&self->connection_->hpack_compressor_,
                                       saw_encoding_errors);
@@ -370,7 +392,17 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
               absl::StrCat("Connection not in map: ",
                            absl::CEscape(self->connection_->connection_id_)));
         }
-        it->second->Set(std::move(self->connection_->endpoint_));
+        DataEndpoints& data_endpoints = *it->second;
+        if (data_endpoints.endpoints.size() >= data_endpoints.lanes) {
+          return absl::InternalError(
+              absl::StrCat("Too many data endpoints for connection: ",
+                           absl::CEscape(self->connection_->connection_id_)));
+        }
+        data_endpoints.endpoints.push_back(
+            std::move(self->connection_->endpoint_));
+        if (data_endpoints.endpoints.size() == data_endpoints.lanes) {
+          data_endpoints.ready.Set(std::move(data_endpoints.endpoints));
+        }
         return absl::OkStatus();
       });
 }
@@ -112,7 +112,7 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
 
    private:
     void Done(absl::optional<absl::string_view> error = absl::nullopt);
-    void NewConnectionID();
+    void NewConnectionID(uint32_t data_lanes);
     RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
     const RefCountedPtr<ChaoticGoodServerListener> listener_;
     RefCountedPtr<HandshakingState> handshaking_state_;
@@ -125,6 +125,8 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
     absl::BitGen bitgen_;
     std::string connection_id_;
     int32_t data_alignment_;
+    // For a control endpoint: data lanes the client asked for, if any.
+    absl::optional<uint32_t> requested_data_lanes_;
   };
 
   void Start(Server*, const std::vector<grpc_pollset*>*) override {
@@ -148,9 +150,15 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
       ee_listener_;
   Mutex mu_;
   bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  // Data endpoints of a connection, in the order the client set them up.
+  struct DataEndpoints {
+    explicit DataEndpoints(uint32_t lanes) : lanes(lanes) {}
+    const uint32_t lanes;
+    std::vector<PromiseEndpoint> endpoints;
+    InterActivityLatch<std::vector<PromiseEndpoint>> ready;
+  };
   // Map of connection id to endpoints connectivity.
-  absl::flat_hash_map<std::string,
-                      std::shared_ptr<InterActivityLatch<PromiseEndpoint>>>
+  absl::flat_hash_map<std::string, std::shared_ptr<DataEndpoints>>
       connectivity_map_ ABSL_GUARDED_BY(mu_);
   absl::flat_hash_set<OrphanablePtr<ActiveConnection>> connection_list_
       ABSL_GUARDED_BY(mu_);
@@ -345,6 +345,17 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
     PromiseEndpoint data_endpoint,
     std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
     HPackParser hpack_parser, HPackCompressor hpack_encoder)
+    : ChaoticGoodServerTransport(args, std::move(control_endpoint),
+                                 SingleDataLane(std::move(data_endpoint)),
+                                 std::move(event_engine),
+                                 std::move(hpack_parser),
+                                 std::move(hpack_encoder)) {}
+
+ChaoticGoodServerTransport::ChaoticGoodServerTransport(
+    const ChannelArgs& args, PromiseEndpoint control_endpoint,
+    std::vector<PromiseEndpoint> data_endpoints,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
+    HPackParser hpack_parser, HPackCompressor hpack_encoder)
     : call_arena_allocator_(MakeRefCounted<CallArenaAllocator>(
           args.GetObject<ResourceQuota>()
               ->memory_quota()
@@ -353,7 +364,7 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
       event_engine_(event_engine),
       outgoing_frames_(4) {
   auto transport = MakeRefCounted<ChaoticGoodTransport>(
-      std::move(control_endpoint), std::move(data_endpoint),
+      std::move(control_endpoint), std::move(data_endpoints),
       std::move(hpack_parser), std::move(hpack_encoder));
   writer_ = MakeActivity(TransportWriteLoop(transport),
                          EventEngineWakeupScheduler(event_engine),
@@ -28,6 +28,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
@@ -85,6 +86,14 @@ class ChaoticGoodServerTransport final : public ServerTransport {
       std::shared_ptr<grpc_event_engine::experimental::EventEngine>
           event_engine,
       HPackParser hpack_parser, HPackCompressor hpack_encoder);
+  // Message payloads are striped across data_endpoints, which must be in the
+  // same order as at the client.
+  ChaoticGoodServerTransport(
+      const ChannelArgs& args, PromiseEndpoint control_endpoint,
+      std::vector<PromiseEndpoint> data_endpoints,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine,
+      HPackParser hpack_parser, HPackCompressor hpack_encoder);
 
   FilterStackTransport* filter_stack_transport() override { return nullptr; }
   ClientTransport* client_transport() override { return nullptr; }
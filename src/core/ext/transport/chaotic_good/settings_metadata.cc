@@ -43,6 +43,9 @@ Arena::PoolPtr<grpc_metadata_batch> SettingsMetadata::ToMetadataBatch() {
   if (alignment.has_value()) {
     add("chaotic-good-alignment", absl::StrCat(alignment.value()));
   }
+  if (data_lanes.has_value()) {
+    add("chaotic-good-data-lanes", absl::StrCat(data_lanes.value()));
+  }
   return md;
 }
 
@@ -73,6 +76,14 @@ absl::StatusOr<SettingsMetadata> SettingsMetadata::FromMetadataBatch(
     }
     md.alignment = alignment;
   }
+  v = batch.GetStringValue("chaotic-good-data-lanes", &buffer);
+  if (v.has_value()) {
+    uint32_t data_lanes;
+    if (!absl::SimpleAtoi(*v, &data_lanes) || data_lanes == 0) {
+      return absl::UnavailableError(absl::StrCat("Invalid data lanes: ", *v));
+    }
+    md.data_lanes = data_lanes;
+  }
   return md;
 }
 
@@ -34,6 +34,9 @@ struct SettingsMetadata {
   absl::optional<ConnectionType> connection_type;
   absl::optional<std::string> connection_id;
   absl::optional<uint32_t> alignment;
+  // Number of data connections: requested by the client on the control
+  // connection, and granted by the server in its reply. Absent means one.
+  absl::optional<uint32_t> data_lanes;
 
   Arena::PoolPtr<grpc_metadata_batch> ToMetadataBatch();
   static absl::StatusOr<SettingsMetadata> FromMetadataBatch(
@@ -93,34 +93,58 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   return output;
 }
 
-grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
-  size_t nbits;
-  const uint8_t* in;
-  uint8_t* out;
-  grpc_slice output;
-  uint64_t temp = 0;
-  uint32_t temp_length = 0;
-
-  nbits = 0;
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    nbits += grpc_chttp2_huffsyms[*in].length;
+static size_t huffman_compressed_bits(const uint8_t* in, const uint8_t* end) {
+  // Four independent sums, so that the table loads are not serialized on a
+  // single accumulator.
+  size_t n0 = 0, n1 = 0, n2 = 0, n3 = 0;
+  for (; end - in >= 4; in += 4) {
+    n0 += grpc_chttp2_huffsyms[in[0]].length;
+    n1 += grpc_chttp2_huffsyms[in[1]].length;
+    n2 += grpc_chttp2_huffsyms[in[2]].length;
+    n3 += grpc_chttp2_huffsyms[in[3]].length;
   }
+  for (; in != end; ++in) {
+    n0 += grpc_chttp2_huffsyms[*in].length;
+  }
+  return n0 + n1 + n2 + n3;
+}
+
+size_t grpc_chttp2_huffman_compressed_length(const grpc_slice& input) {
+  const size_t nbits = huffman_compressed_bits(GRPC_SLICE_START_PTR(input),
+                                               GRPC_SLICE_END_PTR(input));
+  return nbits / 8 + (nbits % 8 != 0);
+}
 
-  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+// Compress input into a slice of exactly output_length bytes, as computed by
+// grpc_chttp2_huffman_compressed_length.
+static grpc_slice huffman_compress_to_length(const grpc_slice& input,
+                                             size_t output_length) {
+  grpc_slice output = GRPC_SLICE_MALLOC(output_length);
+  uint8_t* out = GRPC_SLICE_START_PTR(output);
+  // Codes are at most 30 bits, so with fewer than 32 bits pending a 64 bit
+  // accumulator never overflows, and whole 32 bit words can be written out at
+  // once rather than a byte at a time.
+  uint64_t temp = 0;
+  uint32_t temp_length = 0;
+  for (const uint8_t* in = GRPC_SLICE_START_PTR(input);
+       in != GRPC_SLICE_END_PTR(input); ++in) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    temp = (temp << sym.length) | sym.bits;
+    temp_length += sym.length;
+    if (temp_length >= 32) {
+      temp_length -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp >> temp_length);
+      out[0] = static_cast<uint8_t>(word >> 24);
+      out[1] = static_cast<uint8_t>(word >> 16);
+      out[2] = static_cast<uint8_t>(word >> 8);
+      out[3] = static_cast<uint8_t>(word);
+      out += 4;
     }
   }
+  while (temp_length >= 8) {
+    temp_length -= 8;
+    *out++ = static_cast<uint8_t>(temp >> temp_length);
+  }
 
   if (temp_length) {
     // NB: the following integer arithmetic operation needs to be in its
@@ -137,6 +161,19 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   return output;
 }
 
+grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
+  return huffman_compress_to_length(
+      input, grpc_chttp2_huffman_compressed_length(input));
+}
+
+bool grpc_chttp2_huffman_compress_if_smaller(const grpc_slice& input,
+                                             grpc_slice* output) {
+  const size_t compressed_length = grpc_chttp2_huffman_compressed_length(input);
+  if (compressed_length >= GRPC_SLICE_LENGTH(input)) return false;
+  *output = huffman_compress_to_length(input, compressed_length);
+  return true;
+}
+
 struct huff_out {
   uint32_t temp;
   uint32_t temp_length;
@@ -19,6 +19,7 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_BIN_ENCODER_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_BIN_ENCODER_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <grpc/slice.h>
@@ -32,6 +33,15 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input);
 // standard. Returns a new slice, does not take ownership of the input
 grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input);
 
+// Returns the number of bytes grpc_chttp2_huffman_compress would produce for
+// input, without compressing it
+size_t grpc_chttp2_huffman_compressed_length(const grpc_slice& input);
+
+// Huffman compress input only if that makes it shorter. Returns true and
+// stores a new slice in *output if so, otherwise leaves *output untouched.
+bool grpc_chttp2_huffman_compress_if_smaller(const grpc_slice& input,
+                                             grpc_slice* output);
+
 // equivalent to:
 // grpc_slice x = grpc_chttp2_base64_encode(input);
 // grpc_slice y = grpc_chttp2_huffman_compress(x);
@@ -33,15 +33,18 @@
 
 #include "absl/base/attributes.h"
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/meta/type_traits.h"
 #include "absl/random/random.h"
 #include "absl/status/status.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/cord.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
+#include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 #include "absl/types/variant.h"
@@ -109,6 +112,7 @@
 #include "src/core/telemetry/stats_data.h"
 #include "src/core/telemetry/tcp_tracer.h"
 #include "src/core/util/http_client/parser.h"
+#include "src/core/util/latent_see.h"
 #include "src/core/util/string.h"
 #include "src/core/util/useful.h"
 
@@ -149,6 +153,9 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                              grpc_error_handle error);
 static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void write_coalescing_timer_expired_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void flush_coalesced_write(grpc_chttp2_transport* t);
 
 static void read_action(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                         grpc_error_handle error);
@@ -458,6 +465,31 @@ static void read_channel_args(grpc_chttp2_transport* t,
   if (max_hpack_table_size >= 0) {
     t->hpack_compressor.SetMaxUsableSize(max_hpack_table_size);
   }
+  t->write_coalescing_window = std::chrono::microseconds(std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US)
+             .value_or(0)));
+  t->write_coalescing_bytes = std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_BYTES)
+             .value_or(64 * 1024));
+
+  t->hpack_compressor.SetHuffmanEncodeValues(
+      channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_HUFFMAN_ENCODE_VALUES)
+          .value_or(false));
+  const int warm_start_entries =
+      channel_args.GetInt(GRPC_ARG_HTTP2_HPACK_WARM_START_ENTRIES).value_or(0);
+  absl::flat_hash_set<std::string> warm_start_keys;
+  for (absl::string_view key : absl::StrSplit(
+           channel_args.GetString(GRPC_ARG_HTTP2_HPACK_WARM_START_KEYS)
+               .value_or(""),
+           ',', absl::SkipWhitespace())) {
+    warm_start_keys.emplace(absl::StripAsciiWhitespace(key));
+  }
+  if (is_client && warm_start_entries > 0 && !warm_start_keys.empty()) {
+    t->hpack_compressor.EnableWarmStart(
+        grpc_core::HPackWarmStartCache::ForTarget(
+            t->peer_string.as_string_view()),
+        warm_start_entries, std::move(warm_start_keys));
+  }
 
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
@@ -728,6 +760,12 @@ static void close_transport_locked(grpc_chttp2_transport* t,
           grpc_error_set_int(error, grpc_core::StatusIntProperty::kRpcStatus,
                              GRPC_STATUS_UNAVAILABLE);
     }
+    // Don't leave a held write waiting out its window.
+    if (t->write_coalescing_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->write_coalescing_timer_handle)) {
+      t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+      flush_coalesced_write(t);
+    }
     if (t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE) {
       if (t->close_transport_on_writes_finished.ok()) {
         t->close_transport_on_writes_finished =
@@ -970,12 +1008,74 @@ static void set_write_state(grpc_chttp2_transport* t,
   }
 }
 
+// Only writes carrying stream data are held by the coalescing window; control
+// frames (pings, settings, flow control updates, resets) go out promptly.
+static bool write_may_be_coalesced(grpc_chttp2_initiate_write_reason reason) {
+  switch (reason) {
+    case GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_INITIAL_METADATA:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_TRAILING_METADATA:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static void flush_coalesced_write(grpc_chttp2_transport* t) {
+  grpc_core::global_stats().IncrementHttp2WritesCoalesced(
+      std::exchange(t->write_coalescing_requests, 0));
+  t->combiner->FinallyRun(
+      grpc_core::InitTransportClosure<write_action_begin_locked>(
+          t->Ref(), &t->write_action_begin_locked),
+      absl::OkStatus());
+}
+
+static void write_coalescing_timer_expired_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  DCHECK(error.ok());
+  CHECK(t->write_coalescing_timer_handle != TaskHandle::kInvalid);
+  t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+  flush_coalesced_write(t.get());
+}
+
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
+  if (t->write_coalescing_timer_handle != TaskHandle::kInvalid) {
+    // A write is being held: join it, and start it early if this write can't
+    // wait or enough data has queued up. If the timer can't be cancelled it
+    // has already fired, and its closure will start the write.
+    ++t->write_coalescing_requests;
+    if ((!write_may_be_coalesced(reason) ||
+         t->write_coalescing_pending_bytes >= t->write_coalescing_bytes) &&
+        t->event_engine->Cancel(t->write_coalescing_timer_handle)) {
+      t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+      flush_coalesced_write(t);
+    }
+    return;
+  }
   switch (t->write_state) {
     case GRPC_CHTTP2_WRITE_STATE_IDLE:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
+      if (t->write_coalescing_window.count() > 0 &&
+          write_may_be_coalesced(reason) &&
+          t->write_coalescing_pending_bytes < t->write_coalescing_bytes) {
+        t->write_coalescing_requests = 1;
+        t->write_coalescing_timer_handle = t->event_engine->RunAfter(
+            t->write_coalescing_window, [t = t->Ref()]() mutable {
+              grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+              grpc_core::ExecCtx exec_ctx;
+              auto* tp = t.get();
+              tp->combiner->Run(
+                  grpc_core::InitTransportClosure<
+                      write_coalescing_timer_expired_locked>(
+                      std::move(t), &tp->write_coalescing_timer_expired_locked),
+                  absl::OkStatus());
+            });
+        break;
+      }
       // Note that the 'write_action_begin_locked' closure is being scheduled
       // on the 'finally_scheduler' of t->combiner. This means that
       // 'write_action_begin_locked' is called only *after* all the other
@@ -1026,6 +1126,7 @@ static void write_action_begin_locked(
     grpc_error_handle /*error_ignored*/) {
   GRPC_LATENT_SEE_INNER_SCOPE("write_action_begin_locked");
   CHECK(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
+  t->write_coalescing_pending_bytes = 0;
   grpc_chttp2_begin_write_result r;
   if (!t->closed_with_error.ok()) {
     r.writing = false;
@@ -1057,6 +1158,7 @@ static void write_action_begin_locked(
 }
 
 static void write_action(grpc_chttp2_transport* t) {
+  GRPC_LATENT_SEE_INNER_SCOPE("write_action");
   void* cl = t->context_list;
   if (!t->context_list->empty()) {
     // Transfer the ownership of the context list to the endpoint and create and
@@ -1103,6 +1205,7 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
 static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
+  GRPC_LATENT_SEE_INNER_SCOPE("write_action_end_locked");
   t->write_size_policy.EndWrite(error.ok());
 
   bool closed = false;
@@ -1512,6 +1615,8 @@ static void send_message_locked(
       *list = cb;
     }
 
+    t->write_coalescing_pending_bytes +=
+        op_payload->send_message.send_message->Length();
     if (s->id != 0 && (!s->write_buffering || s->flow_controlled_buffer.length >
                                                   t->write_buffer_size)) {
       grpc_chttp2_mark_stream_writable(t, s);
@@ -2787,6 +2892,7 @@ static void read_action_parse_loop_locked(
 static void read_action_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
+  GRPC_LATENT_SEE_INNER_SCOPE("read_action_locked");
   // got an incoming read, cancel any pending keepalive timers
   t->keepalive_incoming_data_wanted = false;
   if (t->keepalive_ping_timeout_handle != TaskHandle::kInvalid) {
@@ -0,0 +1,101 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multisym.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/log/check.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+
+namespace grpc_core {
+
+namespace {
+
+MultiSymHuffTables* BuildTables() {
+  constexpr int kBits = MultiSymHuffTables::kLookupBits;
+  auto* tables = new MultiSymHuffTables();
+  // For every kBits wide prefix, the symbol whose code it starts with and that
+  // code's length, or a length of 0 if the code is longer than kBits.
+  std::vector<uint16_t> prefix_sym(1 << kBits);
+  std::vector<uint8_t> prefix_len(1 << kBits);
+  for (int i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[i];
+    if (sym.length > kBits) continue;
+    const int shift = kBits - sym.length;
+    for (unsigned j = sym.bits << shift; j < (sym.bits + 1) << shift; j++) {
+      prefix_sym[j] = i;
+      prefix_len[j] = sym.length;
+    }
+  }
+  for (unsigned i = 0; i < (1u << kBits); i++) {
+    const int first_len = prefix_len[i];
+    uint32_t entry = prefix_sym[i] | (first_len << 16);
+    int num_syms = first_len == 0 ? 0 : 1;
+    int total_len = first_len;
+    const int rest = kBits - first_len;
+    if (first_len != 0 && rest > 0) {
+      // Pad the remaining bits with ones to find the second symbol; it only
+      // counts if it fits entirely in the remaining bits.
+      const unsigned next = ((i << first_len) | ((1u << first_len) - 1)) &
+                            ((1u << kBits) - 1);
+      if (prefix_len[next] != 0 && prefix_len[next] <= rest) {
+        entry |= prefix_sym[next] << 8;
+        total_len += prefix_len[next];
+        num_syms = 2;
+      }
+    }
+    tables->lookup[i] = entry | (total_len << 20) | (num_syms << 24);
+  }
+  // Canonical tables for the long codes.
+  int num_long = 0;
+  for (int len = kBits + 1; len <= MultiSymHuffTables::kMaxCodeLength;
+       len++) {
+    tables->first_index[len] = num_long;
+    uint32_t first_code = UINT32_MAX;
+    uint32_t last_code = 0;
+    for (int i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
+      const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[i];
+      if (static_cast<int>(sym.length) != len) continue;
+      tables->syms[num_long++] = i;
+      first_code = std::min(first_code, sym.bits);
+      last_code = std::max(last_code, sym.bits);
+    }
+    tables->count[len] = num_long - tables->first_index[len];
+    if (tables->count[len] == 0) continue;
+    // The HPACK code is canonical, so codes of the same length are
+    // contiguous.
+    CHECK_EQ(last_code - first_code + 1, tables->count[len]);
+    tables->first_code[len] = first_code;
+    std::sort(tables->syms + tables->first_index[len], tables->syms + num_long,
+              [](uint16_t a, uint16_t b) {
+                return grpc_chttp2_huffsyms[a].bits <
+                       grpc_chttp2_huffsyms[b].bits;
+              });
+  }
+  return tables;
+}
+
+}  // namespace
+
+const MultiSymHuffTables& GetMultiSymHuffTables() {
+  static const MultiSymHuffTables* const tables = BuildTables();
+  return *tables;
+}
+
+}  // namespace grpc_core
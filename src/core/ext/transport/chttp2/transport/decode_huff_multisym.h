@@ -0,0 +1,156 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTISYM_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTISYM_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+
+// Lookup tables for MultiSymHuffDecoder, built once from the HPACK static
+// huffman table.
+struct MultiSymHuffTables {
+  static constexpr int kLookupBits = 15;
+  static constexpr int kMaxCodeLength = 30;
+  static constexpr uint16_t kEos = 256;
+
+  // Indexed by the next kLookupBits bits of input. Each entry packs:
+  //   bits 0..7:   first symbol
+  //   bits 8..15:  second symbol
+  //   bits 16..19: length of the first symbol, or 0 if its code is longer
+  //                than kLookupBits
+  //   bits 20..23: combined length of both symbols
+  //   bits 24..25: number of symbols decoded (0, 1 or 2)
+  uint32_t lookup[1 << kLookupBits];
+  // Codes longer than kLookupBits are decoded canonically: for each length,
+  // the codes of that length form a contiguous range starting at
+  // first_code[length], whose symbols are listed in code order at
+  // syms[first_index[length]].
+  uint32_t first_code[kMaxCodeLength + 1];
+  uint16_t first_index[kMaxCodeLength + 1];
+  uint16_t count[kMaxCodeLength + 1];
+  uint16_t syms[257];
+};
+
+const MultiSymHuffTables& GetMultiSymHuffTables();
+
+// HPACK huffman decoder that resolves up to two symbols per table lookup.
+// It is a drop-in alternative to the generated HuffDecoder in decode_huff.h,
+// with the same interface and acceptance rules: the sink is called once per
+// decoded byte, decoding stops at EOS, and trailing bits must be all ones.
+template <typename F>
+class MultiSymHuffDecoder {
+ public:
+  MultiSymHuffDecoder(F sink, const uint8_t* begin, const uint8_t* end)
+      : sink_(sink),
+        begin_(begin),
+        end_(end),
+        tables_(GetMultiSymHuffTables()) {}
+
+  bool Run() {
+    while (true) {
+      Refill();
+      if (buffer_len_ == 0) return true;
+      const uint32_t entry = tables_.lookup[LookupIndex()];
+      const int first_len = (entry >> 16) & 0xf;
+      if (first_len != 0) {
+        // The first symbol needs more bits than are left: only padding
+        // remains.
+        if (first_len > buffer_len_) break;
+        sink_(static_cast<uint8_t>(entry));
+        const int total_len = (entry >> 20) & 0xf;
+        if ((entry >> 24) == 2 && total_len <= buffer_len_) {
+          sink_(static_cast<uint8_t>(entry >> 8));
+          buffer_len_ -= total_len;
+        } else {
+          buffer_len_ -= first_len;
+        }
+        continue;
+      }
+      const int sym = DecodeLong();
+      if (sym < 0) break;
+      if (sym == MultiSymHuffTables::kEos) return true;
+      sink_(static_cast<uint8_t>(sym));
+    }
+    return (buffer_ & Mask(buffer_len_)) == Mask(buffer_len_);
+  }
+
+ private:
+  static uint64_t Mask(int bits) { return (uint64_t{1} << bits) - 1; }
+
+  // Ensures at least kMaxCodeLength bits are buffered, unless the input is
+  // exhausted.
+  void Refill() {
+    if (buffer_len_ >= 32) return;
+    if (end_ - begin_ >= 4) {
+      buffer_ = (buffer_ << 32) | (static_cast<uint64_t>(begin_[0]) << 24) |
+                (static_cast<uint64_t>(begin_[1]) << 16) |
+                (static_cast<uint64_t>(begin_[2]) << 8) |
+                static_cast<uint64_t>(begin_[3]);
+      begin_ += 4;
+      buffer_len_ += 32;
+      return;
+    }
+    while (begin_ != end_) {
+      buffer_ = (buffer_ << 8) | *begin_++;
+      buffer_len_ += 8;
+    }
+  }
+
+  // Returns the next kLookupBits bits, padded with ones if fewer are left.
+  // Padding cannot change the decoding of a symbol that fits in the buffered
+  // bits, since the code is prefix free.
+  size_t LookupIndex() const {
+    constexpr int kBits = MultiSymHuffTables::kLookupBits;
+    if (buffer_len_ >= kBits) {
+      return (buffer_ >> (buffer_len_ - kBits)) & Mask(kBits);
+    }
+    return ((buffer_ << (kBits - buffer_len_)) | Mask(kBits - buffer_len_)) &
+           Mask(kBits);
+  }
+
+  // Decodes one symbol whose code is longer than kLookupBits. Returns -1 if
+  // the buffered bits do not hold a complete code.
+  int DecodeLong() {
+    const int max_len = buffer_len_ < MultiSymHuffTables::kMaxCodeLength
+                            ? buffer_len_
+                            : MultiSymHuffTables::kMaxCodeLength;
+    for (int len = MultiSymHuffTables::kLookupBits + 1; len <= max_len;
+         ++len) {
+      const uint32_t code =
+          static_cast<uint32_t>((buffer_ >> (buffer_len_ - len)) & Mask(len));
+      const uint32_t offset = code - tables_.first_code[len];
+      if (offset < tables_.count[len]) {
+        buffer_len_ -= len;
+        return tables_.syms[tables_.first_index[len] + offset];
+      }
+    }
+    return -1;
+  }
+
+  F sink_;
+  const uint8_t* begin_;
+  const uint8_t* const end_;
+  const MultiSymHuffTables& tables_;
+  uint64_t buffer_ = 0;
+  int buffer_len_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTISYM_H
@@ -18,8 +18,11 @@
 
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 
+#include <limits.h>
+
 #include <algorithm>
 #include <cstdint>
+#include <list>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -35,14 +38,19 @@
 #include "src/core/ext/transport/chttp2/transport/varint.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/surface/validate_metadata.h"
 #include "src/core/lib/transport/timeout_encoding.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 namespace grpc_core {
 
 namespace {
 
 constexpr size_t kHeadersFrameHeaderSize = 9;
+// Bounds the memory held by HPackWarmStartCache::ForTarget.
+constexpr size_t kMaxWarmStartTargets = 1024;
 
 }  // namespace
 
@@ -109,6 +117,81 @@ void HPackCompressor::Frame(const EncodeHeaderOptions& options,
   }
 }
 
+RefCountedPtr<HPackWarmStartCache> HPackWarmStartCache::ForTarget(
+    absl::string_view target) {
+  using Target = std::pair<std::string, RefCountedPtr<HPackWarmStartCache>>;
+  struct Targets {
+    Mutex mu;
+    // Most recently used first.
+    std::list<Target> lru ABSL_GUARDED_BY(mu);
+    absl::flat_hash_map<absl::string_view, std::list<Target>::iterator> index
+        ABSL_GUARDED_BY(mu);
+  };
+  static NoDestruct<Targets> targets;
+  MutexLock lock(&targets->mu);
+  auto it = targets->index.find(target);
+  if (it != targets->index.end()) {
+    targets->lru.splice(targets->lru.begin(), targets->lru, it->second);
+    return it->second->second;
+  }
+  if (targets->lru.size() >= kMaxWarmStartTargets) {
+    // Connections still using the evicted cache keep it alive.
+    targets->index.erase(targets->lru.back().first);
+    targets->lru.pop_back();
+  }
+  targets->lru.emplace_front(std::string(target),
+                             MakeRefCounted<HPackWarmStartCache>());
+  targets->index.emplace(targets->lru.front().first, targets->lru.begin());
+  return targets->lru.front().second;
+}
+
+HPackWarmStartCache::HeaderPairs HPackWarmStartCache::Get() const {
+  MutexLock lock(&mu_);
+  return pairs_;
+}
+
+void HPackWarmStartCache::Update(HeaderPairs pairs) {
+  MutexLock lock(&mu_);
+  pairs_ = std::move(pairs);
+}
+
+HPackCompressor::~HPackCompressor() {
+  if (warm_start_ == nullptr) return;
+  global_stats().IncrementHttp2HpackWarmStartBytesSaved(
+      static_cast<int>(std::min<size_t>(warm_start_->bytes_saved, INT_MAX)));
+  HPackWarmStartCache::HeaderPairs pairs;
+  for (const auto& key_values : warm_start_->entries) {
+    for (const auto& value_entry : key_values.second) {
+      const WarmStart::Entry& entry = value_entry.second;
+      if (entry.uses > 1 || (entry.prior && entry.uses > 0)) {
+        pairs.emplace_back(key_values.first, value_entry.first);
+      }
+    }
+  }
+  // Keep what earlier connections learned if this one sent nothing worth
+  // remembering (eg. it failed before its first call).
+  if (!pairs.empty()) warm_start_->cache->Update(std::move(pairs));
+}
+
+void HPackCompressor::EnableWarmStart(RefCountedPtr<HPackWarmStartCache> cache,
+                                      size_t max_entries,
+                                      absl::flat_hash_set<std::string> keys) {
+  warm_start_ = std::make_unique<WarmStart>();
+  warm_start_->max_entries = max_entries;
+  warm_start_->keys = std::move(keys);
+  for (auto& pair : cache->Get()) {
+    if (warm_start_->num_entries == max_entries) break;
+    // Connections to the same target may have been given different keys.
+    if (!warm_start_->keys.contains(pair.first)) continue;
+    WarmStart::Entry& entry =
+        warm_start_->entries[std::move(pair.first)][std::move(pair.second)];
+    if (entry.prior) continue;
+    entry.prior = true;
+    ++warm_start_->num_entries;
+  }
+  warm_start_->cache = std::move(cache);
+}
+
 void HPackCompressor::SetMaxUsableSize(uint32_t max_table_size) {
   max_usable_size_ = max_table_size;
   SetMaxTableSize(std::min(table_.max_size(), max_table_size));
@@ -148,7 +231,9 @@ struct WireValue {
 // Construct a wire value from a slice.
 // true_binary_enabled => use the true binary system
 // is_bin_hdr => the header is -bin suffixed
-WireValue GetWireValue(Slice value, bool true_binary_enabled, bool is_bin_hdr) {
+// huffman_compress => huffman compress non-binary values that shrink
+WireValue GetWireValue(Slice value, bool true_binary_enabled, bool is_bin_hdr,
+                       bool huffman_compress = false) {
   if (is_bin_hdr) {
     if (true_binary_enabled) {
       return WireValue(0x00, true, std::move(value));
@@ -159,7 +244,14 @@ WireValue GetWireValue(Slice value, bool true_binary_enabled, bool is_bin_hdr) {
       return WireValue(0x80, false, std::move(output), hpack_length);
     }
   } else {
-    // TODO(ctiller): opportunistically compress non-binary headers
+    // Only pay for compression when it saves bytes on the wire: the
+    // compressed length is cheap to compute up front, and short or
+    // high-entropy values often do not shrink.
+    grpc_slice compressed;
+    if (huffman_compress && grpc_chttp2_huffman_compress_if_smaller(
+                                value.c_slice(), &compressed)) {
+      return WireValue(0x80, false, Slice(compressed), value.length());
+    }
     return WireValue(0x00, false, std::move(value));
   }
 }
@@ -205,17 +297,21 @@ class BinaryStringValue {
 
 class NonBinaryStringValue {
  public:
-  explicit NonBinaryStringValue(Slice value)
-      : value_(std::move(value)), len_val_(value_.length()) {}
+  NonBinaryStringValue(Slice value, bool huffman_compress)
+      : wire_value_(
+            GetWireValue(std::move(value), false, false, huffman_compress)),
+        len_val_(wire_value_.length) {}
 
   size_t prefix_length() const { return len_val_.length(); }
 
-  void WritePrefix(uint8_t* prefix_data) { len_val_.Write(0x00, prefix_data); }
+  void WritePrefix(uint8_t* prefix_data) {
+    len_val_.Write(wire_value_.huffman_prefix, prefix_data);
+  }
 
-  Slice data() { return std::move(value_); }
+  Slice data() { return std::move(wire_value_.data); }
 
  private:
-  Slice value_;
+  WireValue wire_value_;
   VarintWriter<1> len_val_;
 };
 
@@ -252,7 +348,8 @@ uint32_t Encoder::EmitLitHdrWithNonBinaryStringKeyIncIdx(Slice key_slice,
   StringKey key(std::move(key_slice));
   key.WritePrefix(0x40, output_.AddTiny(key.prefix_length()));
   output_.Append(key.key());
-  NonBinaryStringValue emit(std::move(value_slice));
+  NonBinaryStringValue emit(std::move(value_slice),
+                            compressor_->huffman_encode_values_);
   emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
   // Allocate an index in the hpack table for this newly emitted entry.
   // (we do so here because we know the length of the key and value)
@@ -303,7 +400,8 @@ void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
   StringKey key(std::move(key_slice));
   key.WritePrefix(0x00, output_.AddTiny(key.prefix_length()));
   output_.Append(key.key());
-  NonBinaryStringValue emit(std::move(value_slice));
+  NonBinaryStringValue emit(std::move(value_slice),
+                            compressor_->huffman_encode_values_);
   emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
   output_.Append(emit.data());
 }
@@ -360,11 +458,55 @@ void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
 void Encoder::Encode(const Slice& key, const Slice& value) {
   if (absl::EndsWith(key.as_string_view(), "-bin")) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+  } else if (compressor_->warm_start_ != nullptr &&
+             compressor_->warm_start_->keys.contains(key.as_string_view())) {
+    EncodeWithWarmStart(key, value);
   } else {
     EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   }
 }
 
+void Encoder::EncodeWithWarmStart(const Slice& key, const Slice& value) {
+  auto& warm_start = *compressor_->warm_start_;
+  HPackCompressor::WarmStart::Entry* entry = nullptr;
+  auto key_it = warm_start.entries.find(key.as_string_view());
+  if (key_it != warm_start.entries.end()) {
+    auto value_it = key_it->second.find(value.as_string_view());
+    if (value_it != key_it->second.end()) entry = &value_it->second;
+  }
+  if (entry == nullptr) {
+    // First use of this pair: send it unindexed, but start tracking it if
+    // there is room and it would fit in a table of the initial size, which
+    // every peer supports.
+    if (warm_start.num_entries < warm_start.max_entries &&
+        hpack_constants::SizeForEntry(key.size(), value.size()) <=
+            hpack_constants::kInitialTableSize) {
+      ++warm_start.num_entries;
+      warm_start.entries[key.as_string_view()][value.as_string_view()].uses =
+          1;
+    }
+    EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    return;
+  }
+  ++entry->uses;
+  auto& table = hpack_table();
+  if (table.ConvertableToDynamicIndex(entry->index)) {
+    const uint32_t dynamic_index = table.DynamicIndex(entry->index);
+    // An unindexed literal would have cost a type byte plus both strings with
+    // their length prefixes.
+    const size_t literal_size =
+        1 + VarintWriter<1>(key.size()).length() + key.size() +
+        VarintWriter<1>(value.size()).length() + value.size();
+    warm_start.bytes_saved +=
+        literal_size - VarintWriter<1>(dynamic_index).length();
+    EmitIndexed(dynamic_index);
+    return;
+  }
+  // The pair repeats, either on an earlier connection or this one: insert it
+  // into the table so that later uses become references.
+  entry->index = EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(), value.Ref());
+}
+
 void Compressor<HttpSchemeMetadata, HttpSchemeCompressor>::EncodeWith(
     HttpSchemeMetadata, HttpSchemeMetadata::ValueType value, Encoder* encoder) {
   switch (value) {
@@ -22,9 +22,13 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -35,6 +39,9 @@
 
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder_table.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
@@ -83,6 +90,8 @@ class Encoder {
                                  const Slice& slice, uint32_t* index,
                                  size_t max_compression_size);
 
+  void EncodeWithWarmStart(const Slice& key, const Slice& value);
+
   void NoteEncodingError() { saw_encoding_errors_ = true; }
   bool saw_encoding_errors() const { return saw_encoding_errors_; }
 
@@ -327,12 +336,33 @@ class Compressor<HttpSchemeMetadata, HttpSchemeCompressor> {
 
 }  // namespace hpack_encoder_detail
 
+// Header pairs that repeated on earlier connections to the same target.
+// A connection that shares the cache indexes these pairs from their first use,
+// so that even a short-lived connection sends them as table references on its
+// later calls.
+class HPackWarmStartCache : public RefCounted<HPackWarmStartCache> {
+ public:
+  using HeaderPairs = std::vector<std::pair<std::string, std::string>>;
+
+  // Returns the cache shared by all connections to target. Only the most
+  // recently used targets keep their caches.
+  static RefCountedPtr<HPackWarmStartCache> ForTarget(absl::string_view target);
+
+  HeaderPairs Get() const ABSL_LOCKS_EXCLUDED(mu_);
+  // Replaces the cached pairs with those learned by a finished connection.
+  void Update(HeaderPairs pairs) ABSL_LOCKS_EXCLUDED(mu_);
+
+ private:
+  mutable Mutex mu_;
+  HeaderPairs pairs_ ABSL_GUARDED_BY(mu_);
+};
+
 class HPackCompressor {
   class SliceIndex;
 
  public:
   HPackCompressor() = default;
-  ~HPackCompressor() = default;
+  ~HPackCompressor();
 
   HPackCompressor(const HPackCompressor&) = delete;
   HPackCompressor& operator=(const HPackCompressor&) = delete;
@@ -344,6 +374,20 @@ class HPackCompressor {
 
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
+  // Huffman compress non-binary header values whenever that makes them
+  // shorter on the wire.
+  void SetHuffmanEncodeValues(bool enabled) {
+    huffman_encode_values_ = enabled;
+  }
+  // Index non-binary header pairs that repeated on earlier connections
+  // sharing cache, tracking up to max_entries pairs. Pairs that repeat on this
+  // connection are handed to the next one when the compressor is destroyed.
+  // Only pairs whose key is in keys are tracked: their values are carried
+  // over to other connections, so keys must not name headers that may hold
+  // credentials.
+  void EnableWarmStart(RefCountedPtr<HPackWarmStartCache> cache,
+                       size_t max_entries,
+                       absl::flat_hash_set<std::string> keys);
 
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
@@ -389,8 +433,28 @@ class HPackCompressor {
   // if non-zero, advertise to the decoder that we'll start using a table
   // of this size
   bool advertise_table_size_change_ = false;
+  bool huffman_encode_values_ = false;
   HPackEncoderTable table_;
 
+  struct WarmStart {
+    struct Entry {
+      // Index in table_, or 0 if not yet inserted.
+      uint32_t index = 0;
+      uint32_t uses = 0;
+      // True if the pair repeated on an earlier connection.
+      bool prior = false;
+    };
+    RefCountedPtr<HPackWarmStartCache> cache;
+    size_t max_entries;
+    absl::flat_hash_set<std::string> keys;
+    size_t num_entries = 0;
+    // key -> value -> entry
+    absl::flat_hash_map<std::string, absl::flat_hash_map<std::string, Entry>>
+        entries;
+    size_t bytes_saved = 0;
+  };
+  std::unique_ptr<WarmStart> warm_start_;
+
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
 };
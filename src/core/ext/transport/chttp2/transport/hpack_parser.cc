@@ -41,10 +41,12 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multisym.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/match.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_refcount.h"
@@ -364,9 +366,11 @@ HpackParseStatus HPackParser::String::ParseHuff(Input* input, uint32_t length,
   // Grab the byte range, and iterate through it.
   const uint8_t* p = input->cur_ptr();
   input->Advance(length);
-  return HuffDecoder<Out>(output, p, p + length).Run()
-             ? HpackParseStatus::kOk
-             : HpackParseStatus::kParseHuffFailed;
+  const bool ok =
+      IsHpackMultisymHuffmanDecoderEnabled()
+          ? MultiSymHuffDecoder<Out>(output, p, p + length).Run()
+          : HuffDecoder<Out>(output, p, p + length).Run();
+  return ok ? HpackParseStatus::kOk : HpackParseStatus::kParseHuffFailed;
 }
 
 struct HPackParser::String::StringResult {
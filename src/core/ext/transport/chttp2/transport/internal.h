@@ -502,6 +502,23 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   /// policy for how much data we're willing to put into one http2 write
   grpc_core::Chttp2WriteSizePolicy write_size_policy;
 
+  /// write coalescing: a write requested for stream data on an idle transport
+  /// is held for up to write_coalescing_window, so that writes from other
+  /// streams can join it, unless write_coalescing_bytes of message data are
+  /// queued first
+  grpc_event_engine::experimental::EventEngine::Duration
+      write_coalescing_window{0};
+  size_t write_coalescing_bytes = 0;
+  /// message bytes queued since the last write began
+  size_t write_coalescing_pending_bytes = 0;
+  /// number of write requests absorbed by the held write
+  int write_coalescing_requests = 0;
+  /// set while a write is being held
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      write_coalescing_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  grpc_closure write_coalescing_timer_expired_locked;
+
   bool reading_paused_on_pending_induced_frames = false;
   /// Based on channel args, preferred_rx_crypto_frame_sizes are advertised to
   /// the peer
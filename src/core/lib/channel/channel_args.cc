@@ -26,8 +26,12 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "absl/base/no_destructor.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
@@ -44,6 +48,20 @@
 
 namespace grpc_core {
 
+constexpr const char* WellKnownChannelArg::kNames[];
+
+int WellKnownChannelArg::IdOf(absl::string_view name) {
+  static const absl::NoDestructor<absl::flat_hash_map<absl::string_view, int>>
+      ids([] {
+        absl::flat_hash_map<absl::string_view, int> ids;
+        for (int i = 0; i < kCount; i++) ids.emplace(kNames[i], i);
+        return ids;
+      }());
+  auto it = ids->find(name);
+  if (it == ids->end()) return -1;
+  return it->second;
+}
+
 const grpc_arg_pointer_vtable ChannelArgs::Value::int_vtable_{
     // copy
     [](void* p) { return p; },
@@ -98,8 +116,15 @@ ChannelArgs::ChannelArgs() = default;
 ChannelArgs::~ChannelArgs() = default;
 ChannelArgs::ChannelArgs(const ChannelArgs& other) = default;
 ChannelArgs& ChannelArgs::operator=(const ChannelArgs& other) = default;
-ChannelArgs::ChannelArgs(ChannelArgs&& other) noexcept = default;
-ChannelArgs& ChannelArgs::operator=(ChannelArgs&& other) noexcept = default;
+// Moving leaves other empty, so its summary has to be reset to match.
+ChannelArgs::ChannelArgs(ChannelArgs&& other) noexcept
+    : args_(std::move(other.args_)),
+      summary_(std::exchange(other.summary_, Summary())) {}
+ChannelArgs& ChannelArgs::operator=(ChannelArgs&& other) noexcept {
+  args_ = std::move(other.args_);
+  summary_ = std::exchange(other.summary_, Summary());
+  return *this;
+}
 
 const ChannelArgs::Value* ChannelArgs::Get(absl::string_view name) const {
   return args_.Lookup(name);
@@ -114,7 +139,7 @@ bool ChannelArgs::operator<(const ChannelArgs& other) const {
 }
 
 bool ChannelArgs::operator==(const ChannelArgs& other) const {
-  return args_ == other.args_;
+  return summary_.hash == other.summary_.hash && args_ == other.args_;
 }
 
 bool ChannelArgs::operator!=(const ChannelArgs& other) const {
@@ -122,11 +147,28 @@ bool ChannelArgs::operator!=(const ChannelArgs& other) const {
 }
 
 bool ChannelArgs::WantMinimalStack() const {
-  return GetBool(GRPC_ARG_MINIMAL_STACK).value_or(false);
+  static constexpr WellKnownChannelArg kMinimalStack(GRPC_ARG_MINIMAL_STACK);
+  return GetBool(kMinimalStack).value_or(false);
 }
 
 ChannelArgs::ChannelArgs(AVL<RefCountedStringValue, Value> args)
-    : args_(std::move(args)) {}
+    : args_(std::move(args)) {
+  args_.ForEach([this](const RefCountedStringValue& key, const Value& value) {
+    summary_.Add(key.as_string_view(), value);
+  });
+}
+
+void ChannelArgs::Summary::Add(absl::string_view key, const Value& value) {
+  hash += absl::HashOf(key, value.Hash());
+  const int id = WellKnownChannelArg::IdOf(key);
+  if (id >= 0) well_known |= uint64_t{1} << id;
+}
+
+void ChannelArgs::Summary::Remove(absl::string_view key, const Value& value) {
+  hash -= absl::HashOf(key, value.Hash());
+  const int id = WellKnownChannelArg::IdOf(key);
+  if (id >= 0) well_known &= ~(uint64_t{1} << id);
+}
 
 ChannelArgs ChannelArgs::Set(grpc_arg arg) const {
   switch (arg.type) {
@@ -187,10 +229,14 @@ ChannelArgs ChannelArgs::Set(absl::string_view name, int value) const {
 }
 
 ChannelArgs ChannelArgs::Set(absl::string_view name, Value value) const {
+  Summary summary = summary_;
   if (const auto* p = args_.Lookup(name)) {
     if (*p == value) return *this;  // already have this value for this key
+    summary.Remove(name, *p);
   }
-  return ChannelArgs(args_.Add(RefCountedStringValue(name), std::move(value)));
+  summary.Add(name, value);
+  return ChannelArgs(args_.Add(RefCountedStringValue(name), std::move(value)),
+                     summary);
 }
 
 ChannelArgs ChannelArgs::Set(absl::string_view name,
@@ -207,8 +253,11 @@ ChannelArgs ChannelArgs::Set(absl::string_view name, std::string value) const {
 }
 
 ChannelArgs ChannelArgs::Remove(absl::string_view name) const {
-  if (args_.Lookup(name) == nullptr) return *this;
-  return ChannelArgs(args_.Remove(name));
+  const auto* p = args_.Lookup(name);
+  if (p == nullptr) return *this;
+  Summary summary = summary_;
+  summary.Remove(name, *p);
+  return ChannelArgs(args_.Remove(name), summary);
 }
 
 ChannelArgs ChannelArgs::RemoveAllKeysWithPrefix(
@@ -279,6 +328,17 @@ absl::optional<bool> ChannelArgs::GetBool(absl::string_view name) const {
   }
 }
 
+size_t ChannelArgs::Value::Hash() const {
+  if (rep_.c_vtable() == &int_vtable_) {
+    return absl::HashOf(reinterpret_cast<intptr_t>(rep_.c_pointer()));
+  }
+  if (rep_.c_vtable() == &string_vtable_) {
+    return absl::HashOf(
+        static_cast<RefCountedString*>(rep_.c_pointer())->as_string_view());
+  }
+  return 0;
+}
+
 absl::string_view ChannelArgs::Value::ToString(
     std::list<std::string>& backing_strings) const {
   if (rep_.c_vtable() == &string_vtable_) {
@@ -316,6 +376,10 @@ ChannelArgs ChannelArgs::UnionWith(ChannelArgs other) const {
   if (args_.Height() <= other.args_.Height()) {
     args_.ForEach(
         [&other](const RefCountedStringValue& key, const Value& value) {
+          if (const auto* p = other.args_.Lookup(key)) {
+            other.summary_.Remove(key.as_string_view(), *p);
+          }
+          other.summary_.Add(key.as_string_view(), value);
           other.args_ = other.args_.Add(key, value);
         });
     return other;
@@ -324,6 +388,7 @@ ChannelArgs ChannelArgs::UnionWith(ChannelArgs other) const {
     other.args_.ForEach(
         [&result](const RefCountedStringValue& key, const Value& value) {
           if (result.args_.Lookup(key) == nullptr) {
+            result.summary_.Add(key.as_string_view(), value);
             result.args_ = result.args_.Add(key, value);
           }
         });
@@ -336,7 +401,7 @@ ChannelArgs ChannelArgs::FuzzingReferenceUnionWith(ChannelArgs other) const {
   args_.ForEach([&other](const RefCountedStringValue& key, const Value& value) {
     other.args_ = other.args_.Add(key, value);
   });
-  return other;
+  return ChannelArgs(std::move(other.args_));
 }
 
 void ChannelArgs::ChannelArgsDeleter::operator()(
@@ -35,6 +35,7 @@
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/avl/avl.h"
@@ -289,6 +290,66 @@ struct ChannelArgNameTraits<grpc_event_engine::experimental::EventEngine> {
   }
 };
 
+// A channel arg read on hot paths such as subchannel and transport creation.
+//
+// Args named in kNames get a dense id at compile time, and every ChannelArgs
+// records which of them it holds. Looking one up by WellKnownChannelArg
+// rather than by name returns straight away when it is not set (the usual
+// case, leaving the default in force) instead of walking the tree and
+// comparing strings. Other names still work but get no fast path.
+class WellKnownChannelArg {
+ public:
+  static constexpr const char* kNames[] = {
+      GRPC_ARG_ABSOLUTE_MAX_METADATA_SIZE,
+      GRPC_ARG_DEFAULT_AUTHORITY,
+      GRPC_ARG_ENABLE_CHANNELZ,
+      GRPC_ARG_ENABLE_RETRIES,
+      GRPC_ARG_HTTP2_BDP_PROBE,
+      GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA,
+      GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE,
+      GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS,
+      GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS,
+      GRPC_ARG_KEEPALIVE_TIME_MS,
+      GRPC_ARG_KEEPALIVE_TIMEOUT_MS,
+      GRPC_ARG_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE,
+      GRPC_ARG_MAX_METADATA_SIZE,
+      GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH,
+      GRPC_ARG_MAX_RECONNECT_BACKOFF_MS,
+      GRPC_ARG_MAX_SEND_MESSAGE_LENGTH,
+      GRPC_ARG_MIN_RECONNECT_BACKOFF_MS,
+      GRPC_ARG_MINIMAL_STACK,
+      GRPC_ARG_PRIMARY_USER_AGENT_STRING,
+      GRPC_ARG_SECONDARY_USER_AGENT_STRING,
+      GRPC_ARG_SERVICE_CONFIG,
+      "grpc.testing.fixed_reconnect_backoff_ms",
+  };
+  static constexpr int kCount = sizeof(kNames) / sizeof(kNames[0]);
+  static_assert(kCount <= 64, "ids must fit in a uint64_t mask");
+
+  explicit constexpr WellKnownChannelArg(const char* name)
+      : name_(name), id_(IdOf(name, 0)) {}
+
+  absl::string_view name() const { return name_; }
+  // -1 if the name is not in kNames.
+  constexpr int id() const { return id_; }
+
+  // Run time version of the id lookup, for names of args being set.
+  static int IdOf(absl::string_view name);
+
+ private:
+  static constexpr bool Equal(const char* a, const char* b) {
+    return *a == *b && (*a == '\0' || Equal(a + 1, b + 1));
+  }
+  static constexpr int IdOf(const char* name, int i) {
+    return i == kCount              ? -1
+           : Equal(name, kNames[i]) ? i
+                                    : IdOf(name, i + 1);
+  }
+
+  const char* name_;
+  int id_;
+};
+
 class ChannelArgs {
  public:
   class Pointer {
@@ -371,6 +432,10 @@ class ChannelArgs {
 
     absl::string_view ToString(std::list<std::string>& backing) const;
 
+    // Consistent with operator==. Pointers may compare equal without sharing
+    // an address, so they all hash alike.
+    size_t Hash() const;
+
     grpc_arg MakeCArg(const char* name) const;
 
     bool operator<(const Value& rhs) const { return rep_ < rhs.rep_; }
@@ -489,6 +554,9 @@ class ChannelArgs {
   }
   GRPC_MUST_USE_RESULT ChannelArgs Remove(absl::string_view name) const;
   bool Contains(absl::string_view name) const;
+  bool Contains(WellKnownChannelArg arg) const {
+    return MayContain(arg) && Contains(arg.name());
+  }
 
   GRPC_MUST_USE_RESULT ChannelArgs
   RemoveAllKeysWithPrefix(absl::string_view prefix) const;
@@ -514,6 +582,25 @@ class ChannelArgs {
       absl::string_view name) const;
   absl::optional<bool> GetBool(absl::string_view name) const;
 
+  // Lookups of well known args, skipping the tree walk when they are not set.
+  absl::optional<int> GetInt(WellKnownChannelArg arg) const {
+    if (!MayContain(arg)) return absl::nullopt;
+    return GetInt(arg.name());
+  }
+  absl::optional<absl::string_view> GetString(WellKnownChannelArg arg) const {
+    if (!MayContain(arg)) return absl::nullopt;
+    return GetString(arg.name());
+  }
+  absl::optional<Duration> GetDurationFromIntMillis(
+      WellKnownChannelArg arg) const {
+    if (!MayContain(arg)) return absl::nullopt;
+    return GetDurationFromIntMillis(arg.name());
+  }
+  absl::optional<bool> GetBool(WellKnownChannelArg arg) const {
+    if (!MayContain(arg)) return absl::nullopt;
+    return GetBool(arg.name());
+  }
+
   // Object based get/set.
   // Deal with the common case that we set a pointer to an object under
   // the same name in every usage.
@@ -553,6 +640,16 @@ class ChannelArgs {
   bool operator<(const ChannelArgs& other) const;
   bool operator==(const ChannelArgs& other) const;
 
+  // A hash of the contents, kept up to date as args are set and removed.
+  // Equal args have equal hashes, so comparing hashes first is a cheap way to
+  // tell most unequal args apart.
+  size_t hash() const { return summary_.hash; }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const ChannelArgs& args) {
+    return H::combine(std::move(h), args.hash());
+  }
+
   // Helpers for commonly accessed things
 
   bool WantMinimalStack() const;
@@ -564,12 +661,30 @@ class ChannelArgs {
   }
 
  private:
+  // Order independent digest of args_.
+  struct Summary {
+    void Add(absl::string_view key, const Value& value);
+    void Remove(absl::string_view key, const Value& value);
+
+    size_t hash = 0;
+    // Bit i is set if WellKnownChannelArg id i is present.
+    uint64_t well_known = 0;
+  };
+
   explicit ChannelArgs(AVL<RefCountedStringValue, Value> args);
+  ChannelArgs(AVL<RefCountedStringValue, Value> args, Summary summary)
+      : args_(std::move(args)), summary_(summary) {}
 
   GRPC_MUST_USE_RESULT ChannelArgs Set(absl::string_view name,
                                        Value value) const;
 
+  // False only if arg is known not to be set.
+  bool MayContain(WellKnownChannelArg arg) const {
+    return arg.id() < 0 || (summary_.well_known >> arg.id() & 1) != 0;
+  }
+
   AVL<RefCountedStringValue, Value> args_;
+  Summary summary_;
 };
 
 std::ostream& operator<<(std::ostream& out, const ChannelArgs& args);
@@ -18,11 +18,15 @@
 
 #include "src/core/lib/compression/message_compress.h"
 
+#include <stddef.h>
 #include <string.h>
 
 #include <zconf.h>
 #include <zlib.h>
 
+#include <memory>
+#include <utility>
+
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 
@@ -34,9 +38,19 @@
 
 #define OUTPUT_BLOCK_SIZE 1024
 
+// Drops whatever a failed (de)compression appended to output.
+static void truncate_output(grpc_slice_buffer* output, size_t count_before,
+                            size_t length_before) {
+  for (size_t i = count_before; i < output->count; i++) {
+    grpc_core::CSliceUnref(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+}
+
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush), int last_flush) {
   int r = Z_STREAM_END;  // Do not fail on an empty input.
   int flush;
   size_t i;
@@ -48,7 +62,7 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
   zs->next_out = GRPC_SLICE_START_PTR(outbuf);
   flush = Z_NO_FLUSH;
   for (i = 0; i < input->count; i++) {
-    if (i == input->count - 1) flush = Z_FINISH;
+    if (i == input->count - 1) flush = last_flush;
     CHECK(GRPC_SLICE_LENGTH(input->slices[i]) <= uint_max);
     zs->avail_in = static_cast<uInt> GRPC_SLICE_LENGTH(input->slices[i]);
     zs->next_in = GRPC_SLICE_START_PTR(input->slices[i]);
@@ -71,7 +85,7 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
       goto error;
     }
   }
-  if (r != Z_STREAM_END) {
+  if (last_flush == Z_FINISH && r != Z_STREAM_END) {
     VLOG(2) << "zlib: Data error";
     goto error;
   }
@@ -94,52 +108,147 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
+// zlib does not say how much it frees, so the size of each allocation charged
+// to a memory allocator is kept in front of it.
+#define ZALLOC_HEADER_SIZE alignof(max_align_t)
+
+static void* zalloc_charged(void* opaque, unsigned int items,
+                            unsigned int size) {
+  size_t length = ZALLOC_HEADER_SIZE + size_t{items} * size;
+  static_cast<grpc_core::MemoryAllocator*>(opaque)->Reserve(length);
+  char* p = static_cast<char*>(gpr_malloc(length));
+  memcpy(p, &length, sizeof(length));
+  return p + ZALLOC_HEADER_SIZE;
+}
+
+static void zfree_charged(void* opaque, void* address) {
+  char* p = static_cast<char*>(address) - ZALLOC_HEADER_SIZE;
+  size_t length;
+  memcpy(&length, p, sizeof(length));
+  gpr_free(p);
+  static_cast<grpc_core::MemoryAllocator*>(opaque)->Release(length);
+}
+
+namespace grpc_core {
+
+// A zlib stream that can be reset between messages rather than set up anew.
+class ZlibStream {
+ public:
+  // Returns nullptr if zlib fails to set up the stream. Its memory is charged
+  // to 'allocator' if set.
+  static std::unique_ptr<ZlibStream> Create(bool compress, int gzip,
+                                            MemoryAllocator* allocator) {
+    std::unique_ptr<ZlibStream> stream(new ZlibStream(compress, gzip));
+    z_stream* zs = &stream->zs_;
+    zs->zalloc = allocator != nullptr ? zalloc_charged : zalloc_gpr;
+    zs->zfree = allocator != nullptr ? zfree_charged : zfree_gpr;
+    zs->opaque = allocator;
+    int r = compress ? deflateInit2(zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                                    15 | (gzip ? 16 : 0), 8,
+                                    Z_DEFAULT_STRATEGY)
+                     : inflateInit2(zs, 15 | (gzip ? 16 : 0));
+    if (r != Z_OK) {
+      LOG(ERROR) << "zlib: failed to set up a stream (" << r << ")";
+      stream->initialized_ = false;
+      return nullptr;
+    }
+    return stream;
+  }
+
+  ~ZlibStream() {
+    if (!initialized_) return;
+    compress_ ? deflateEnd(&zs_) : inflateEnd(&zs_);
+  }
+
+  // zlib keeps a pointer back to the z_stream.
+  ZlibStream(const ZlibStream&) = delete;
+  ZlibStream& operator=(const ZlibStream&) = delete;
+
+  z_stream* get() { return &zs_; }
+  bool compress() const { return compress_; }
+  bool gzip() const { return gzip_; }
+  void Reset() { compress_ ? deflateReset(&zs_) : inflateReset(&zs_); }
+
+ private:
+  ZlibStream(bool compress, int gzip) : compress_(compress), gzip_(gzip != 0) {
+    memset(&zs_, 0, sizeof(zs_));
+  }
+
+  z_stream zs_;
+  const bool compress_;
+  const bool gzip_;
+  bool initialized_ = true;
+};
+
+ZlibStreamPool::ZlibStreamPool(MemoryAllocator allocator)
+    : allocator_(std::move(allocator)) {}
+
+ZlibStreamPool::~ZlibStreamPool() = default;
+
+std::unique_ptr<ZlibStream> ZlibStreamPool::Get(bool compress, int gzip) {
+  {
+    MutexLock lock(&mu_);
+    auto& idle = idle_[compress][gzip != 0];
+    if (!idle.empty()) {
+      std::unique_ptr<ZlibStream> stream = std::move(idle.back());
+      idle.pop_back();
+      return stream;
+    }
+  }
+  return ZlibStream::Create(compress, gzip, &allocator_);
+}
+
+void ZlibStreamPool::Put(std::unique_ptr<ZlibStream> stream) {
+  stream->Reset();
+  MutexLock lock(&mu_);
+  auto& idle = idle_[stream->compress()][stream->gzip()];
+  if (idle.size() < kMaxIdleStreams) idle.push_back(std::move(stream));
+}
+
+size_t ZlibStreamPool::TestOnlyIdleStreams() {
+  MutexLock lock(&mu_);
+  size_t n = 0;
+  for (auto& by_gzip : idle_) {
+    for (auto& idle : by_gzip) n += idle.size();
+  }
+  return n;
+}
+
+}  // namespace grpc_core
+
+static std::unique_ptr<grpc_core::ZlibStream> get_zlib_stream(
+    grpc_core::ZlibStreamPool* pool, bool compress, int gzip) {
+  if (pool != nullptr) return pool->Get(compress, gzip);
+  return grpc_core::ZlibStream::Create(compress, gzip, nullptr);
+}
+
+static void put_zlib_stream(grpc_core::ZlibStreamPool* pool,
+                            std::unique_ptr<grpc_core::ZlibStream> stream) {
+  if (pool != nullptr) pool->Put(std::move(stream));
+}
+
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                         int gzip) {
-  z_stream zs;
-  int r;
-  size_t i;
+                         int gzip, grpc_core::ZlibStreamPool* pool) {
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
-    }
-    output->count = count_before;
-    output->length = length_before;
-  }
-  deflateEnd(&zs);
+  auto stream = get_zlib_stream(pool, /*compress=*/true, gzip);
+  if (stream == nullptr) return 0;
+  int r = zlib_body(stream->get(), input, output, deflate, Z_FINISH) &&
+          output->length - length_before < input->length;
+  if (!r) truncate_output(output, count_before, length_before);
+  put_zlib_stream(pool, std::move(stream));
   return r;
 }
 
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                           int gzip) {
-  z_stream zs;
-  int r;
-  size_t i;
+                           int gzip, grpc_core::ZlibStreamPool* pool) {
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
-  CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
-    }
-    output->count = count_before;
-    output->length = length_before;
-  }
-  inflateEnd(&zs);
+  auto stream = get_zlib_stream(pool, /*compress=*/false, gzip);
+  if (stream == nullptr) return 0;
+  int r = zlib_body(stream->get(), input, output, inflate, Z_FINISH);
+  if (!r) truncate_output(output, count_before, length_before);
+  put_zlib_stream(pool, std::move(stream));
   return r;
 }
 
@@ -152,16 +261,17 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
 }
 
 static int compress_inner(grpc_compression_algorithm algorithm,
-                          grpc_slice_buffer* input, grpc_slice_buffer* output) {
+                          grpc_slice_buffer* input, grpc_slice_buffer* output,
+                          grpc_core::ZlibStreamPool* pool) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
       // the fallback path always needs to be send uncompressed: we simply
       // rely on that here
       return 0;
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_compress(input, output, 0);
+      return zlib_compress(input, output, 0, pool);
     case GRPC_COMPRESS_GZIP:
-      return zlib_compress(input, output, 1);
+      return zlib_compress(input, output, 1, pool);
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -170,8 +280,9 @@ static int compress_inner(grpc_compression_algorithm algorithm,
 }
 
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
-                      grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+                      grpc_slice_buffer* input, grpc_slice_buffer* output,
+                      grpc_core::ZlibStreamPool* pool) {
+  if (!compress_inner(algorithm, input, output, pool)) {
     copy(input, output);
     return 0;
   }
@@ -179,17 +290,111 @@ int grpc_msg_compress(grpc_compression_algorithm algorithm,
 }
 
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
-                        grpc_slice_buffer* input, grpc_slice_buffer* output) {
+                        grpc_slice_buffer* input, grpc_slice_buffer* output,
+                        grpc_core::ZlibStreamPool* pool) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
       return copy(input, output);
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_decompress(input, output, 0);
+      return zlib_decompress(input, output, 0, pool);
     case GRPC_COMPRESS_GZIP:
-      return zlib_decompress(input, output, 1);
+      return zlib_decompress(input, output, 1, pool);
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
   LOG(ERROR) << "invalid compression algorithm " << algorithm;
   return 0;
 }
+
+namespace grpc_core {
+
+namespace {
+
+// Holds a stream for one call, and gives it back to its pool afterwards.
+class PooledZlibStream {
+ public:
+  PooledZlibStream(std::unique_ptr<ZlibStream> stream, ZlibStreamPool* pool)
+      : stream_(std::move(stream)), pool_(pool) {}
+  ~PooledZlibStream() { put_zlib_stream(pool_, std::move(stream_)); }
+
+  PooledZlibStream(const PooledZlibStream&) = delete;
+  PooledZlibStream& operator=(const PooledZlibStream&) = delete;
+
+  z_stream* get() { return stream_->get(); }
+
+ private:
+  std::unique_ptr<ZlibStream> stream_;
+  ZlibStreamPool* const pool_;
+};
+
+class ZlibStreamCompressor final : public MessageStreamCompressor {
+ public:
+  ZlibStreamCompressor(std::unique_ptr<ZlibStream> stream,
+                       ZlibStreamPool* pool)
+      : stream_(std::move(stream), pool) {}
+
+  bool Compress(grpc_slice_buffer* input, grpc_slice_buffer* output) override {
+    if (failed_) return false;
+    size_t count_before = output->count;
+    size_t length_before = output->length;
+    // A sync flush ends each message on a byte boundary without ending the
+    // stream, so the window carries over to the next message.
+    if (zlib_body(stream_.get(), input, output, deflate, Z_SYNC_FLUSH)) {
+      return true;
+    }
+    failed_ = true;
+    truncate_output(output, count_before, length_before);
+    return false;
+  }
+
+ private:
+  PooledZlibStream stream_;
+  bool failed_ = false;
+};
+
+class ZlibStreamDecompressor final : public MessageStreamDecompressor {
+ public:
+  ZlibStreamDecompressor(std::unique_ptr<ZlibStream> stream,
+                         ZlibStreamPool* pool)
+      : stream_(std::move(stream), pool) {}
+
+  bool Decompress(grpc_slice_buffer* input,
+                  grpc_slice_buffer* output) override {
+    size_t count_before = output->count;
+    size_t length_before = output->length;
+    if (zlib_body(stream_.get(), input, output, inflate, Z_SYNC_FLUSH)) {
+      return true;
+    }
+    truncate_output(output, count_before, length_before);
+    return false;
+  }
+
+ private:
+  PooledZlibStream stream_;
+};
+
+}  // namespace
+
+std::unique_ptr<MessageStreamCompressor> MessageStreamCompressor::Create(
+    grpc_compression_algorithm algorithm, ZlibStreamPool* pool) {
+  if (algorithm != GRPC_COMPRESS_DEFLATE && algorithm != GRPC_COMPRESS_GZIP) {
+    return nullptr;
+  }
+  auto stream = get_zlib_stream(pool, /*compress=*/true,
+                                algorithm == GRPC_COMPRESS_GZIP);
+  if (stream == nullptr) return nullptr;
+  return std::make_unique<ZlibStreamCompressor>(std::move(stream), pool);
+}
+
+std::unique_ptr<MessageStreamDecompressor> MessageStreamDecompressor::Create(
+    grpc_compression_algorithm algorithm, ZlibStreamPool* pool) {
+  if (algorithm != GRPC_COMPRESS_DEFLATE && algorithm != GRPC_COMPRESS_GZIP) {
+    return nullptr;
+  }
+  auto stream = get_zlib_stream(pool, /*compress=*/false,
+                                algorithm == GRPC_COMPRESS_GZIP);
+  if (stream == nullptr) return nullptr;
+  return std::make_unique<ZlibStreamDecompressor>(std::move(stream), pool);
+}
+
+}  // namespace grpc_core
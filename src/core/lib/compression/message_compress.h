@@ -19,20 +19,107 @@
 #ifndef GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
 #define GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
 
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+
 #include <grpc/impl/compression_types.h>
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+
+namespace grpc_core {
+
+class ZlibStream;
+
+// Keeps zlib streams for reuse by later messages and calls instead of setting
+// one up and tearing it down for each: a deflate stream alone holds ~256KiB of
+// state. The memory of every stream the pool hands out is charged to its
+// allocator, and at most kMaxIdleStreams of each kind are kept while unused.
+class ZlibStreamPool {
+ public:
+  static constexpr size_t kMaxIdleStreams = 4;
+
+  explicit ZlibStreamPool(MemoryAllocator allocator);
+  ~ZlibStreamPool();
+
+  ZlibStreamPool(const ZlibStreamPool&) = delete;
+  ZlibStreamPool& operator=(const ZlibStreamPool&) = delete;
+
+  // Returns a stream ready for a new message, or nullptr if zlib could not
+  // set one up.
+  std::unique_ptr<ZlibStream> Get(bool compress, int gzip);
+  // Takes back a stream returned by Get().
+  void Put(std::unique_ptr<ZlibStream> stream);
+
+  size_t TestOnlyIdleStreams();
+
+ private:
+  MemoryAllocator allocator_;
+  Mutex mu_;
+  // Indexed by compress and gzip.
+  std::vector<std::unique_ptr<ZlibStream>> idle_[2][2] ABSL_GUARDED_BY(mu_);
+};
+
+// Compresses the messages of one stream as a single compressed stream. Each
+// message is flushed so that it can be decompressed on arrival, but can refer
+// back to the messages before it, which compresses repetitive message
+// sequences far better than compressing each one alone. The peer must
+// decompress every message, in order, with a MessageStreamDecompressor.
+class MessageStreamCompressor {
+ public:
+  // Returns nullptr if 'algorithm' cannot be streamed, or if zlib could not
+  // set up a stream. The stream comes from 'pool' if set, and must not
+  // outlive it.
+  static std::unique_ptr<MessageStreamCompressor> Create(
+      grpc_compression_algorithm algorithm, ZlibStreamPool* pool = nullptr);
+
+  virtual ~MessageStreamCompressor() = default;
+
+  // Appends the compressed 'input' to 'output', even if it is no smaller.
+  // On failure, output is unchanged, and so it stays for every later message:
+  // those must then be sent uncompressed.
+  virtual bool Compress(grpc_slice_buffer* input,
+                        grpc_slice_buffer* output) = 0;
+};
+
+class MessageStreamDecompressor {
+ public:
+  // Returns nullptr if 'algorithm' cannot be streamed, or if zlib could not
+  // set up a stream. The stream comes from 'pool' if set, and must not
+  // outlive it.
+  static std::unique_ptr<MessageStreamDecompressor> Create(
+      grpc_compression_algorithm algorithm, ZlibStreamPool* pool = nullptr);
+
+  virtual ~MessageStreamDecompressor() = default;
+
+  // Appends the decompressed 'input' to 'output'.
+  // On failure, output is unchanged and the stream must not be used again.
+  virtual bool Decompress(grpc_slice_buffer* input,
+                          grpc_slice_buffer* output) = 0;
+};
+
+}  // namespace grpc_core
+
 // compress 'input' to 'output' using 'algorithm'.
 // On success, appends compressed slices to output and returns 1.
 // On failure, appends uncompressed slices to output and returns 0.
+// The zlib stream comes from 'pool' if set.
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
-                      grpc_slice_buffer* input, grpc_slice_buffer* output);
+                      grpc_slice_buffer* input, grpc_slice_buffer* output,
+                      grpc_core::ZlibStreamPool* pool = nullptr);
 
 // decompress 'input' to 'output' using 'algorithm'.
 // On success, appends slices to output and returns 1.
 // On failure, output is unchanged, and returns 0.
+// The zlib stream comes from 'pool' if set.
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
-                        grpc_slice_buffer* input, grpc_slice_buffer* output);
+                        grpc_slice_buffer* input, grpc_slice_buffer* output,
+                        grpc_core::ZlibStreamPool* pool = nullptr);
 
 #endif  // GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
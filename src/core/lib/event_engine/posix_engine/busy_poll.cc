@@ -0,0 +1,75 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
+
+#include <string>
+
+#include "absl/log/log.h"
+#include "absl/strings/numbers.h"
+#include "absl/types/optional.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/env.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+int MicrosFromEnv(const char* name) {
+  absl::optional<std::string> value = grpc_core::GetEnv(name);
+  if (!value.has_value()) return 0;
+  int micros;
+  if (!absl::SimpleAtoi(*value, &micros) || micros < 0) {
+    LOG(ERROR) << "Ignoring invalid " << name << "=" << *value;
+    return 0;
+  }
+  return micros;
+}
+
+}  // namespace
+
+BusyPollBudget::BusyPollBudget(Duration max)
+    : max_ns_(std::max<int64_t>(max.count(), 0)),
+      min_ns_(std::max<int64_t>(max_ns_ / kMinFraction, max_ns_ > 0 ? 1 : 0)),
+      budget_ns_(max_ns_) {}
+
+BusyPollBudget::Duration BusyPollBudget::MaxFromEnv() {
+  static const int micros = MicrosFromEnv("GRPC_EPOLL_BUSY_POLL_US");
+  return std::chrono::microseconds(micros);
+}
+
+int BusyPollBudget::SocketBusyPollMicrosFromEnv() {
+  static const int micros = MicrosFromEnv("GRPC_SO_BUSY_POLL_US");
+  return micros;
+}
+
+void BusyPollBudget::OnSpinHit() {
+  grpc_core::global_stats().IncrementBusyPollSpinHits();
+  const int64_t budget = budget_ns_.load(std::memory_order_relaxed);
+  budget_ns_.store(std::min(max_ns_, budget * 2), std::memory_order_relaxed);
+}
+
+void BusyPollBudget::OnSpinMiss() {
+  grpc_core::global_stats().IncrementBusyPollSpinMisses();
+  const int64_t budget = budget_ns_.load(std::memory_order_relaxed);
+  budget_ns_.store(std::max(min_ns_, budget / 2), std::memory_order_relaxed);
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
@@ -0,0 +1,92 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_BUSY_POLL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_BUSY_POLL_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// How long a poller spins on non-blocking polls before it blocks.
+//
+// Busy polling trades CPU for latency: an event that arrives while the poller
+// spins is picked up without a wakeup from the kernel. The budget adapts to
+// how often that pays off. It halves after each spin that finds nothing, down
+// to a floor of max / kMinFraction, and doubles after each spin that finds an
+// event, up to max.
+class BusyPollBudget {
+ public:
+  using Duration = std::chrono::nanoseconds;
+
+  static constexpr int64_t kMinFraction = 32;
+
+  // A zero max disables busy polling.
+  explicit BusyPollBudget(Duration max);
+
+  // The max budget configured by GRPC_EPOLL_BUSY_POLL_US, in microseconds;
+  // zero if busy polling is not enabled.
+  static Duration MaxFromEnv();
+  // The SO_BUSY_POLL value, in microseconds, configured by GRPC_SO_BUSY_POLL_US
+  // for accepted sockets; zero if not set.
+  static int SocketBusyPollMicrosFromEnv();
+
+  bool enabled() const { return max_ns_ > 0; }
+  Duration budget() const {
+    return Duration(budget_ns_.load(std::memory_order_relaxed));
+  }
+
+  // Calls poll() until it returns a positive event count or the current
+  // budget, capped at timeout, runs out, and returns that count, or zero if
+  // it found nothing. A negative timeout means no cap. A poll() error ends
+  // the spin without touching the budget, and also returns zero, so that the
+  // caller's blocking poll runs and reports it.
+  template <typename PollFn>
+  int Spin(Duration timeout, PollFn poll) {
+    Duration limit = budget();
+    if (timeout >= Duration::zero()) limit = std::min(limit, timeout);
+    const auto start = std::chrono::steady_clock::now();
+    while (true) {
+      const int r = poll();
+      if (r > 0) {
+        OnSpinHit();
+        return r;
+      }
+      if (r < 0) return 0;
+      if (std::chrono::steady_clock::now() - start >= limit) {
+        OnSpinMiss();
+        return 0;
+      }
+    }
+  }
+
+  void OnSpinHit();
+  void OnSpinMiss();
+
+ private:
+  const int64_t max_ns_;
+  const int64_t min_ns_;
+  std::atomic<int64_t> budget_ns_;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_BUSY_POLL_H
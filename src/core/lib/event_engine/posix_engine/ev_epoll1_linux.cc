@@ -15,14 +15,19 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <string>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/numbers.h"
 #include "absl/strings/str_format.h"
+#include "absl/types/optional.h"
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/status.h>
@@ -43,11 +48,13 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/fork.h"
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/strerror.h"
@@ -120,11 +127,19 @@ class Epoll1EventHandle : public EventHandle {
   void SetWritable() override;
   void SetHasError() override;
   bool IsHandleShutdown() override;
-  inline void ExecutePendingActions() {
+  // If inline_reads is not null, the read closure is appended to it to be run
+  // by the caller rather than scheduled.
+  inline void ExecutePendingActions(
+      Epoll1Poller::Closures* inline_reads = nullptr) {
     // These may execute in Parallel with ShutdownHandle. Thats not an issue
     // because the lockfree event implementation should be able to handle it.
     if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
-      read_closure_->SetReady();
+      if (inline_reads == nullptr) {
+        read_closure_->SetReady();
+      } else if (PosixEngineClosure* closure =
+                     read_closure_->SetReadyAndTakeClosure()) {
+        inline_reads->push_back(closure);
+      }
     }
     if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
       write_closure_->SetReady();
@@ -160,6 +175,18 @@ class Epoll1EventHandle : public EventHandle {
 
 namespace {
 
+bool InlineReadsFromEnv() {
+  absl::optional<std::string> value =
+      grpc_core::GetEnv("GRPC_EPOLL_INLINE_READS");
+  if (!value.has_value()) return false;
+  bool enabled;
+  if (!absl::SimpleAtob(*value, &enabled)) {
+    LOG(ERROR) << "Ignoring invalid GRPC_EPOLL_INLINE_READS=" << *value;
+    return false;
+  }
+  return enabled;
+}
+
 int EpollCreateAndCloexec() {
 #ifdef GRPC_LINUX_EPOLL_CREATE1
   int fd = epoll_create1(EPOLL_CLOEXEC);
@@ -351,7 +378,11 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
 }
 
 Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
-    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+    : scheduler_(scheduler),
+      was_kicked_(false),
+      busy_poll_(BusyPollBudget::MaxFromEnv()),
+      inline_reads_(InlineReadsFromEnv()),
+      closed_(false) {
   g_epoll_set_.epfd = EpollCreateAndCloexec();
   wakeup_fd_ = *CreateWakeupFd();
   CHECK(wakeup_fd_ != nullptr);
@@ -526,16 +557,32 @@ Poller::WorkResult Epoll1Poller::Work(
   Events pending_events;
   bool was_kicked_ext = false;
   if (g_epoll_set_.cursor == g_epoll_set_.num_events) {
-    if (DoEpollWait(timeout) == 0) {
+    int r = 0;
+    if (busy_poll_.enabled() && timeout != EventEngine::Duration::zero()) {
+      const auto spin_start = std::chrono::steady_clock::now();
+      r = busy_poll_.Spin(timeout, [this]() {
+        return DoEpollWait(EventEngine::Duration::zero());
+      });
+      if (r == 0) {
+        timeout = std::max(
+            EventEngine::Duration::zero(),
+            timeout - std::chrono::duration_cast<EventEngine::Duration>(
+                          std::chrono::steady_clock::now() - spin_start));
+      }
+    }
+    if (r == 0 && DoEpollWait(timeout) == 0) {
       return Poller::WorkResult::kDeadlineExceeded;
     }
   }
   {
     grpc_core::MutexLock lock(&mu_);
     // If was_kicked_ is true, collect all pending events in this iteration.
-    if (ProcessEpollEvents(
-            was_kicked_ ? INT_MAX : MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION,
-            pending_events)) {
+    // With inline reads, collect them all as well so that the reads are done
+    // in one batch.
+    if (ProcessEpollEvents(was_kicked_ || inline_reads_
+                               ? INT_MAX
+                               : MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION,
+                           pending_events)) {
       was_kicked_ = false;
       was_kicked_ext = true;
     }
@@ -546,8 +593,20 @@ Poller::WorkResult Epoll1Poller::Work(
   // Run the provided callback.
   schedule_poll_again();
   // Process all pending events inline.
-  for (auto& it : pending_events) {
-    it->ExecutePendingActions();
+  if (!inline_reads_) {
+    for (auto& it : pending_events) {
+      it->ExecutePendingActions();
+    }
+  } else {
+    // Run the read closures on this thread instead of scheduling each of them
+    // separately. Write and error closures are still scheduled.
+    Closures reads;
+    for (auto& it : pending_events) {
+      it->ExecutePendingActions(&reads);
+    }
+    for (PosixEngineClosure* closure : reads) {
+      closure->Run();
+    }
   }
   return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
 }
@@ -589,7 +648,8 @@ namespace experimental {
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::Poller;
 
-Epoll1Poller::Epoll1Poller(Scheduler* /* engine */) {
+Epoll1Poller::Epoll1Poller(Scheduler* /* engine */)
+    : busy_poll_(BusyPollBudget::Duration::zero()), inline_reads_(false) {
   grpc_core::Crash("unimplemented");
 }
 
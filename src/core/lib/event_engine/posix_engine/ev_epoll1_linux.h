@@ -27,8 +27,10 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/port.h"
@@ -76,6 +78,7 @@ class Epoll1Poller : public PosixEventPoller {
  private:
   // This initial vector size may need to be tuned
   using Events = absl::InlinedVector<Epoll1EventHandle*, 5>;
+  using Closures = absl::InlinedVector<PosixEngineClosure*, 5>;
   // Process the epoll events found by DoEpollWait() function.
   // - g_epoll_set.cursor points to the index of the first event to be processed
   // - This function then processes up-to max_epoll_events_to_handle and
@@ -124,6 +127,13 @@ class Epoll1Poller : public PosixEventPoller {
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<WakeupFd> wakeup_fd_;
+  // Spins on non-blocking epoll_waits before blocking, if enabled by
+  // GRPC_EPOLL_BUSY_POLL_US.
+  BusyPollBudget busy_poll_;
+  // If enabled by GRPC_EPOLL_INLINE_READS, Work() handles every event of an
+  // epoll_wait at once and runs the read closures itself, rather than
+  // scheduling each of them on the thread pool.
+  const bool inline_reads_;
   bool closed_;
 };
 
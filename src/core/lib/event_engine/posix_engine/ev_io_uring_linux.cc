@@ -0,0 +1,958 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/iomgr/port.h"
+
+// This polling engine is only relevant on linux kernels supporting io_uring.
+#ifdef GRPC_LINUX_IO_URING
+#include <errno.h>
+#include <limits.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/lib/gprpp/fork.h"
+#include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/strerror.h"
+#include "src/core/lib/gprpp/sync.h"
+
+// NB: We define these here as a fallback in case we're using an older set of
+// kernel headers. Since they are part of the kernel ABI, we are guaranteed
+// they will never change/disagree so defining them here is safe. Whether the
+// running kernel actually supports them is checked at runtime.
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef IORING_POLL_ADD_MULTI
+#define IORING_POLL_ADD_MULTI (1U << 0)
+#endif
+#ifndef IORING_CQE_F_MORE
+#define IORING_CQE_F_MORE (1U << 1)
+#endif
+#ifndef IORING_ENTER_EXT_ARG
+#define IORING_ENTER_EXT_ARG (1U << 3)
+#endif
+#ifndef IORING_FEAT_EXT_ARG
+#define IORING_FEAT_EXT_ARG (1U << 8)
+#endif
+#ifndef IORING_FEAT_RSRC_TAGS
+#define IORING_FEAT_RSRC_TAGS (1U << 10)
+#endif
+
+namespace grpc_event_engine {
+namespace experimental {
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  // The low bits of the user data of this handle's requests tell them apart.
+  // Handles are heap allocated, so these bits of their address are zero.
+  static constexpr uint64_t kTrackErrBit = 1;
+  static constexpr uint64_t kRecvmsgTag = 2;
+  static constexpr uint64_t kSendmsgTag = 4;
+  static constexpr uint64_t kTagMask = 7;
+  // Requests which IoUringPoller::RetryFailedSubmissions has to resubmit.
+  static constexpr uint8_t kRetryPollAdd = 1;
+  static constexpr uint8_t kRetryPollRemove = 2;
+  static constexpr uint8_t kRetryCancelRecvmsg = 4;
+  static constexpr uint8_t kRetryCancelSendmsg = 8;
+  static constexpr uint8_t kRetryAll = kRetryPollAdd | kRetryPollRemove |
+                                       kRetryCancelRecvmsg |
+                                       kRetryCancelSendmsg;
+
+  IoUringEventHandle(int fd, IoUringPoller* poller)
+      : fd_(fd),
+        poller_(poller),
+        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        error_closure_(
+            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  void ReInit(int fd) {
+    fd_ = fd;
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+    grpc_core::MutexLock lock(&mu_);
+    poll_armed_ = false;
+    orphaned_ = false;
+    retry_ops_ = 0;
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why these are atomics.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  bool SubmitRecvmsg(struct msghdr* msg,
+                     absl::AnyInvocable<void(int)> on_done) override;
+  bool SubmitSendmsg(struct msghdr* msg, int flags,
+                     absl::AnyInvocable<void(int)> on_done) override;
+  inline void ExecutePendingActions() {
+    // These may execute in Parallel with ShutdownHandle. Thats not an issue
+    // because the lockfree event implementation should be able to handle it.
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_->SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_->SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_->SetReady();
+    }
+  }
+  grpc_core::Mutex* mu() { return &mu_; }
+  // The tag of the poll request watching this handle. The least significant
+  // bit stores track_err, see IoUringPoller::CreateHandle.
+  uint64_t& UserData() { return user_data_; }
+  // The tag of this handle's recvmsg or sendmsg request.
+  uint64_t MsgOpUserData(uint64_t tag) {
+    return static_cast<uint64_t>(reinterpret_cast<intptr_t>(this)) | tag;
+  }
+  // Must be called with mu() held.
+  bool& PollArmed() { return poll_armed_; }
+  // Must be called with mu() held.
+  bool Orphaned() { return orphaned_; }
+  // The callbacks of the pending recvmsg and sendmsg requests, if any. Must
+  // be called with mu() held.
+  absl::AnyInvocable<void(int)>& RecvmsgDone() { return recvmsg_done_; }
+  absl::AnyInvocable<void(int)>& SendmsgDone() { return sendmsg_done_; }
+  // Must be called with mu() held. True if the kernel may still post
+  // completions for this handle.
+  bool HasPendingRequests() {
+    return poll_armed_ || recvmsg_done_ != nullptr || sendmsg_done_ != nullptr;
+  }
+  // Requests which failed to be submitted, a mask of kRetry* bits. Must be
+  // called with mu() held.
+  uint8_t& RetryOps() { return retry_ops_; }
+  std::list<EventHandle*>::iterator& OrphanedListPos() {
+    return orphaned_list_pos_;
+  }
+  std::list<EventHandle*>::iterator& RetryListPos() { return retry_list_pos_; }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  void HandleShutdownInternal(absl::Status why);
+  // Cancels the pending recvmsg and sendmsg requests, if any.
+  void CancelMsgOps() ABSL_EXCLUSIVE_LOCKS_REQUIRED(poller_->mu_, mu_);
+  bool SubmitMsgOp(uint64_t tag, struct msghdr* msg, int flags,
+                   absl::AnyInvocable<void(int)> on_done);
+  // See Epoll1EventHandle::ShutdownHandle for explanation on why a mutex is
+  // required. It additionally guards the state of the poll request.
+  grpc_core::Mutex mu_;
+  int fd_;
+  uint64_t user_data_ = 0;
+  // True while a poll request for this handle is registered with the ring.
+  // Guarded by mu_.
+  bool poll_armed_ = false;
+  // Guarded by mu_.
+  bool orphaned_ = false;
+  // Guarded by mu_.
+  absl::AnyInvocable<void(int)> recvmsg_done_;
+  absl::AnyInvocable<void(int)> sendmsg_done_;
+  // Guarded by mu_.
+  uint8_t retry_ops_ = 0;
+  std::list<EventHandle*>::iterator orphaned_list_pos_;
+  std::list<EventHandle*>::iterator retry_list_pos_;
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+};
+
+namespace {
+
+// Size of the submission queue. The completion queue is twice as large. Poll
+// requests are submitted one at a time, so this only needs to be large enough
+// to keep the completion queue from overflowing under bursts of readiness
+// events; overflowing completions are buffered by the kernel
+// (IORING_FEAT_NODROP) and flushed on the next wait.
+constexpr unsigned kIoUringEntries = 1024;
+
+// Tag used for completions of poll removal and cancellation requests, which
+// are ignored.
+constexpr uint64_t kCancelUserData = 0;
+
+// How often Work() retries submissions which failed, see
+// IoUringPoller::RetryFailedSubmissions.
+constexpr EventEngine::Duration kSubmitRetryInterval =
+    std::chrono::milliseconds(10);
+
+constexpr uint32_t kPollEvents = POLLIN | POLLPRI | POLLOUT | POLLERR | POLLHUP;
+
+// Multishot poll requests (IORING_POLL_ADD_MULTI) landed in Linux 5.13
+// together with IORING_FEAT_RSRC_TAGS, which is used as the feature probe.
+constexpr uint32_t kRequiredFeatures = IORING_FEAT_SINGLE_MMAP |
+                                       IORING_FEAT_NODROP |
+                                       IORING_FEAT_EXT_ARG |
+                                       IORING_FEAT_RSRC_TAGS;
+
+// Same layout as struct io_uring_getevents_arg, which older kernel headers do
+// not provide.
+struct GetEventsArg {
+  uint64_t sigmask;
+  uint32_t sigmask_sz;
+  uint32_t pad;
+  uint64_t ts;
+};
+
+// Same layout as struct __kernel_timespec.
+struct KernelTimespec {
+  int64_t tv_sec;
+  long long tv_nsec;
+};
+
+int IoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+// Probe whether the running kernel supports every io_uring feature the
+// poller depends on. Kernels may also disable io_uring entirely (e.g. through
+// the kernel.io_uring_disabled sysctl or a seccomp filter).
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::experimental::SupportsWakeupFd()) {
+    return false;
+  }
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = IoUringSetup(1, &params);
+  if (fd < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring_setup unavailable: " << grpc_core::StrError(errno);
+    return false;
+  }
+  close(fd);
+  if ((params.features & kRequiredFeatures) != kRequiredFeatures) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring lacks required features: " << params.features;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  if (!read_closure_->IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+
+  // If release_fd is not NULL, we should be relinquishing control of the file
+  // descriptor fd->fd (but we still own the grpc_fd structure).
+  if (release_fd != nullptr) {
+    *release_fd = fd_;
+  } else {
+    shutdown(fd_, SHUT_RDWR);
+    close(fd_);
+  }
+
+  {
+    // The poll request holds its own reference to the underlying file, so
+    // it has to be cancelled explicitly. The handle can only be reused once
+    // every request referring to it has posted its final completion, see
+    // IoUringPoller::ProcessCompletions. If a cancellation cannot be
+    // submitted right now, it is retried by IoUringPoller::Work.
+    grpc_core::MutexLock poller_lock(&poller_->mu_);
+    grpc_core::MutexLock lock(&mu_);
+    orphaned_ = true;
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+    pending_read_.store(false, std::memory_order_release);
+    pending_write_.store(false, std::memory_order_release);
+    pending_error_.store(false, std::memory_order_release);
+    // An orphaned handle is never re-armed.
+    poller_->DequeueRetry(this, kRetryPollAdd);
+    if (poll_armed_ && (retry_ops_ & kRetryPollRemove) == 0) {
+      absl::Status status = poller_->SubmitPollRemove(user_data_);
+      if (!status.ok()) {
+        LOG(ERROR) << "io_uring poll remove failed for fd " << fd_ << ": "
+                   << status;
+        poller_->QueueRetry(this, kRetryPollRemove);
+      }
+    }
+    CancelMsgOps();
+    if (HasPendingRequests()) {
+      orphaned_list_pos_ = poller_->orphaned_io_uring_handles_list_.insert(
+          poller_->orphaned_io_uring_handles_list_.end(), this);
+    } else {
+      poller_->DequeueRetry(this, kRetryAll);
+      poller_->free_io_uring_handles_list_.push_back(this);
+    }
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
+                          GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_->SetShutdown(why)) {
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+void IoUringEventHandle::CancelMsgOps() {
+  if (recvmsg_done_ != nullptr && (retry_ops_ & kRetryCancelRecvmsg) == 0 &&
+      !poller_->SubmitCancel(MsgOpUserData(kRecvmsgTag)).ok()) {
+    poller_->QueueRetry(this, kRetryCancelRecvmsg);
+  }
+  if (sendmsg_done_ != nullptr && (retry_ops_ & kRetryCancelSendmsg) == 0 &&
+      !poller_->SubmitCancel(MsgOpUserData(kSendmsgTag)).ok()) {
+    poller_->QueueRetry(this, kRetryCancelSendmsg);
+  }
+}
+
+bool IoUringEventHandle::SubmitMsgOp(uint64_t tag, struct msghdr* msg,
+                                     int flags,
+                                     absl::AnyInvocable<void(int)> on_done) {
+  grpc_core::MutexLock lock(&mu_);
+  if (orphaned_ || read_closure_->IsShutdown()) {
+    return false;
+  }
+  absl::AnyInvocable<void(int)>& done =
+      tag == kRecvmsgTag ? recvmsg_done_ : sendmsg_done_;
+  DCHECK(done == nullptr);
+  // Set before submitting, the completion is processed with mu_ held.
+  done = std::move(on_done);
+  absl::Status status = poller_->SubmitMsgOp(
+      tag == kRecvmsgTag ? IORING_OP_RECVMSG : IORING_OP_SENDMSG, fd_, msg,
+      static_cast<uint32_t>(flags), MsgOpUserData(tag));
+  if (!status.ok()) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring msg request failed for fd " << fd_ << ": " << status;
+    done = nullptr;
+    return false;
+  }
+  return true;
+}
+
+bool IoUringEventHandle::SubmitRecvmsg(struct msghdr* msg,
+                                       absl::AnyInvocable<void(int)> on_done) {
+  return SubmitMsgOp(kRecvmsgTag, msg, 0, std::move(on_done));
+}
+
+bool IoUringEventHandle::SubmitSendmsg(struct msghdr* msg, int flags,
+                                       absl::AnyInvocable<void(int)> on_done) {
+  return SubmitMsgOp(kSendmsgTag, msg, flags, std::move(on_done));
+}
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+  if (!SetupRing()) {
+    return;
+  }
+  wakeup_fd_ = *CreateWakeupFd();
+  CHECK(wakeup_fd_ != nullptr);
+  GRPC_TRACE_LOG(event_engine_poller, INFO)
+      << "grpc io_uring fd: " << ring_.ring_fd;
+  absl::Status status =
+      SubmitPollAdd(wakeup_fd_->ReadFd(), POLLIN,
+                    reinterpret_cast<uint64_t>(wakeup_fd_.get()));
+  if (!status.ok()) {
+    // Nothing else uses the ring yet; give it up so that MakeIoUringPoller
+    // falls back to another poller.
+    LOG(ERROR) << "io_uring wakeup fd poll add failed: " << status;
+    Close();
+    return;
+  }
+  grpc_core::MutexLock lock(&mu_);
+  wakeup_poll_armed_ = true;
+}
+
+bool IoUringPoller::SetupRing() {
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = IoUringSetup(kIoUringEntries, &params);
+  if (fd < 0) {
+    LOG(ERROR) << "io_uring_setup failed: " << grpc_core::StrError(errno);
+    return false;
+  }
+  if ((params.features & kRequiredFeatures) != kRequiredFeatures) {
+    close(fd);
+    return false;
+  }
+  size_t sq_ring_size =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  size_t cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  size_t ring_size = std::max(sq_ring_size, cq_ring_size);
+  void* ring_ptr = mmap(nullptr, ring_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (ring_ptr == MAP_FAILED) {
+    LOG(ERROR) << "io_uring ring mmap failed: " << grpc_core::StrError(errno);
+    close(fd);
+    return false;
+  }
+  size_t sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  void* sqes_ptr = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (sqes_ptr == MAP_FAILED) {
+    LOG(ERROR) << "io_uring sqes mmap failed: " << grpc_core::StrError(errno);
+    munmap(ring_ptr, ring_size);
+    close(fd);
+    return false;
+  }
+  char* base = static_cast<char*>(ring_ptr);
+  ring_.sq_head = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+  ring_.sq_tail = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+  ring_.sq_mask = reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+  ring_.sq_array = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+  ring_.sqes = static_cast<io_uring_sqe*>(sqes_ptr);
+  ring_.cq_head = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+  ring_.cq_tail = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+  ring_.cq_mask = reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+  ring_.cqes = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+  ring_.ring_ptr = ring_ptr;
+  ring_.ring_size = ring_size;
+  ring_.sqes_ptr = sqes_ptr;
+  ring_.sqes_size = sqes_size;
+  ring_.ring_fd = fd;
+  return true;
+}
+
+absl::Status IoUringPoller::SubmitSqe(
+    absl::FunctionRef<void(io_uring_sqe*)> prepare) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  if (ring_.ring_fd < 0) {
+    return absl::FailedPreconditionError("io_uring poller is closed");
+  }
+  // Every entry is submitted right away, so the submission queue never holds
+  // more than one entry and cannot be full here.
+  unsigned tail = *ring_.sq_tail;
+  DCHECK_EQ(__atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE), tail);
+  unsigned index = tail & *ring_.sq_mask;
+  io_uring_sqe* sqe = &ring_.sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  prepare(sqe);
+  ring_.sq_array[index] = index;
+  __atomic_store_n(ring_.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  int r;
+  do {
+    r = IoUringEnter(ring_.ring_fd, 1, 0, 0, nullptr, 0);
+  } while (r < 0 && errno == EINTR);
+  int saved_errno = r < 0 ? errno : EAGAIN;
+  if (r == 1 || __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE) != tail) {
+    return absl::OkStatus();
+  }
+  // Without IORING_SETUP_SQPOLL the kernel only consumes entries inside
+  // io_uring_enter, and it did not consume this one. Take it back, otherwise
+  // it would be submitted together with the next entry.
+  __atomic_store_n(ring_.sq_tail, tail, __ATOMIC_RELEASE);
+  return absl::UnavailableError(
+      absl::StrCat("io_uring_enter: ", grpc_core::StrError(saved_errno)));
+}
+
+absl::Status IoUringPoller::SubmitPollAdd(int fd, uint32_t events,
+                                          uint64_t user_data) {
+  return SubmitSqe([fd, events, user_data](io_uring_sqe* sqe) {
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    // poll_events also works on big endian kernels for masks which fit in 16
+    // bits.
+    sqe->poll_events = static_cast<uint16_t>(events);
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->user_data = user_data;
+  });
+}
+
+absl::Status IoUringPoller::SubmitPollRemove(uint64_t user_data) {
+  return SubmitSqe([user_data](io_uring_sqe* sqe) {
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = user_data;
+    sqe->user_data = kCancelUserData;
+  });
+}
+
+absl::Status IoUringPoller::SubmitCancel(uint64_t user_data) {
+  return SubmitSqe([user_data](io_uring_sqe* sqe) {
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = user_data;
+    sqe->user_data = kCancelUserData;
+  });
+}
+
+absl::Status IoUringPoller::SubmitMsgOp(uint8_t opcode, int fd,
+                                        struct msghdr* msg, uint32_t flags,
+                                        uint64_t user_data) {
+  return SubmitSqe([opcode, fd, msg, flags, user_data](io_uring_sqe* sqe) {
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(msg);
+    sqe->len = 1;
+    sqe->msg_flags = flags;
+    sqe->user_data = user_data;
+  });
+}
+
+void IoUringPoller::QueueRetry(IoUringEventHandle* handle, uint8_t ops) {
+  if (handle->RetryOps() == 0) {
+    handle->RetryListPos() = retry_io_uring_handles_list_.insert(
+        retry_io_uring_handles_list_.end(), handle);
+  }
+  handle->RetryOps() |= ops;
+}
+
+void IoUringPoller::DequeueRetry(IoUringEventHandle* handle, uint8_t ops) {
+  if (handle->RetryOps() == 0) {
+    return;
+  }
+  handle->RetryOps() &= ~ops;
+  if (handle->RetryOps() == 0) {
+    retry_io_uring_handles_list_.erase(handle->RetryListPos());
+  }
+}
+
+bool IoUringPoller::RetryFailedSubmissions() {
+  if (!wakeup_poll_armed_) {
+    wakeup_poll_armed_ =
+        SubmitPollAdd(wakeup_fd_->ReadFd(), POLLIN,
+                      reinterpret_cast<uint64_t>(wakeup_fd_.get()))
+            .ok();
+    if (!wakeup_poll_armed_) {
+      return false;
+    }
+  }
+  while (!retry_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        retry_io_uring_handles_list_.front());
+    grpc_core::MutexLock lock(handle->mu());
+    uint8_t& ops = handle->RetryOps();
+    if ((ops & IoUringEventHandle::kRetryPollAdd) != 0 &&
+        SubmitPollAdd(handle->WrappedFd(), kPollEvents, handle->UserData())
+            .ok()) {
+      handle->PollArmed() = true;
+      ops &= ~IoUringEventHandle::kRetryPollAdd;
+    }
+    if ((ops & IoUringEventHandle::kRetryPollRemove) != 0 &&
+        SubmitPollRemove(handle->UserData()).ok()) {
+      ops &= ~IoUringEventHandle::kRetryPollRemove;
+    }
+    if ((ops & IoUringEventHandle::kRetryCancelRecvmsg) != 0 &&
+        SubmitCancel(handle->MsgOpUserData(IoUringEventHandle::kRecvmsgTag))
+            .ok()) {
+      ops &= ~IoUringEventHandle::kRetryCancelRecvmsg;
+    }
+    if ((ops & IoUringEventHandle::kRetryCancelSendmsg) != 0 &&
+        SubmitCancel(handle->MsgOpUserData(IoUringEventHandle::kSendmsgTag))
+            .ok()) {
+      ops &= ~IoUringEventHandle::kRetryCancelSendmsg;
+    }
+    if (ops != 0) {
+      // The ring is still busy; try again on the next Work().
+      return false;
+    }
+    retry_io_uring_handles_list_.pop_front();
+  }
+  return true;
+}
+
+void IoUringPoller::MaybeRecycleHandle(IoUringEventHandle* handle) {
+  if (!handle->Orphaned() || handle->HasPendingRequests()) {
+    return;
+  }
+  orphaned_io_uring_handles_list_.erase(handle->OrphanedListPos());
+  DequeueRetry(handle, IoUringEventHandle::kRetryAll);
+  free_io_uring_handles_list_.push_back(handle);
+}
+
+void IoUringPoller::Shutdown() {}
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+
+  {
+    grpc_core::MutexLock sq_lock(&sq_mu_);
+    if (ring_.ring_fd >= 0) {
+      munmap(ring_.sqes_ptr, ring_.sqes_size);
+      munmap(ring_.ring_ptr, ring_.ring_size);
+      close(ring_.ring_fd);
+      ring_.ring_fd = -1;
+    }
+  }
+
+  while (!free_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    delete handle;
+  }
+  while (!orphaned_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        orphaned_io_uring_handles_list_.front());
+    orphaned_io_uring_handles_list_.pop_front();
+    delete handle;
+  }
+  retry_io_uring_handles_list_.clear();
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  grpc_core::MutexLock lock(&mu_);
+  if (free_io_uring_handles_list_.empty()) {
+    new_handle = new IoUringEventHandle(fd, this);
+  } else {
+    new_handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    new_handle->ReInit(fd);
+  }
+  // Use the least significant bit of the user data to store track_err, for
+  // the same reasons as Epoll1Poller::CreateHandle.
+  new_handle->UserData() =
+      static_cast<uint64_t>(reinterpret_cast<intptr_t>(new_handle) |
+                            (track_err ? IoUringEventHandle::kTrackErrBit : 0));
+  grpc_core::MutexLock handle_lock(new_handle->mu());
+  absl::Status status = SubmitPollAdd(fd, kPollEvents, new_handle->UserData());
+  new_handle->PollArmed() = status.ok();
+  if (!status.ok()) {
+    LOG(ERROR) << "io_uring poll add failed for fd " << fd << ": " << status;
+    QueueRetry(new_handle, IoUringEventHandle::kRetryPollAdd);
+  }
+  return new_handle;
+}
+
+// Reaps up to max_cqes_to_handle completions from the completion ring.
+// Completions of poll requests are converted into pending actions on the
+// corresponding handles. A completion without IORING_CQE_F_MORE means the
+// multishot request terminated: either because it was cancelled by
+// OrphanHandle, in which case the handle is recycled once nothing else refers
+// to it, or because the kernel dropped it (e.g. after a completion queue
+// overflow), in which case it is re-armed. Completions of recvmsg and sendmsg
+// requests run the callbacks given to SubmitRecvmsg/SubmitSendmsg.
+bool IoUringPoller::ProcessCompletions(int max_cqes_to_handle,
+                                       Events& pending_events) {
+  const uint64_t wakeup_user_data =
+      reinterpret_cast<uint64_t>(wakeup_fd_.get());
+  unsigned head = *ring_.cq_head;
+  unsigned tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  bool was_kicked = false;
+  for (int idx = 0; idx < max_cqes_to_handle && head != tail; idx++, head++) {
+    const io_uring_cqe* cqe = &ring_.cqes[head & *ring_.cq_mask];
+    const uint64_t user_data = cqe->user_data;
+    const int32_t res = cqe->res;
+    const bool more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+    if (user_data == kCancelUserData) {
+      continue;
+    }
+    if (user_data == wakeup_user_data) {
+      if (res > 0) {
+        CHECK(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+      }
+      if (!more) {
+        absl::Status status =
+            SubmitPollAdd(wakeup_fd_->ReadFd(), POLLIN, wakeup_user_data);
+        if (!status.ok()) {
+          // Resubmitted by RetryFailedSubmissions.
+          LOG(ERROR) << "io_uring wakeup fd poll add failed: " << status;
+          wakeup_poll_armed_ = false;
+        }
+      }
+      continue;
+    }
+    const uint64_t tag = user_data & IoUringEventHandle::kTagMask;
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        static_cast<intptr_t>(user_data & ~IoUringEventHandle::kTagMask));
+    grpc_core::MutexLock lock(handle->mu());
+    if (tag == IoUringEventHandle::kRecvmsgTag ||
+        tag == IoUringEventHandle::kSendmsgTag) {
+      const bool recv = tag == IoUringEventHandle::kRecvmsgTag;
+      absl::AnyInvocable<void(int)>& done =
+          recv ? handle->RecvmsgDone() : handle->SendmsgDone();
+      DequeueRetry(handle, recv ? IoUringEventHandle::kRetryCancelRecvmsg
+                                : IoUringEventHandle::kRetryCancelSendmsg);
+      scheduler_->Run(
+          [on_done = std::move(done), res]() mutable { on_done(res); });
+      done = nullptr;
+      MaybeRecycleHandle(handle);
+      continue;
+    }
+    bool track_err = (tag & IoUringEventHandle::kTrackErrBit) != 0;
+    if (!more) {
+      handle->PollArmed() = false;
+      DequeueRetry(handle, IoUringEventHandle::kRetryPollRemove);
+    }
+    if (handle->Orphaned()) {
+      MaybeRecycleHandle(handle);
+      continue;
+    }
+    bool cancel = res < 0 || (res & POLLHUP) != 0;
+    bool error = res > 0 && (res & POLLERR) != 0;
+    bool read_ev = res > 0 && (res & (POLLIN | POLLPRI)) != 0;
+    bool write_ev = res > 0 && (res & POLLOUT) != 0;
+    bool err_fallback = error && !track_err;
+    if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                  write_ev || cancel || err_fallback,
+                                  error && !err_fallback)) {
+      pending_events.push_back(handle);
+    }
+    if (!more && res >= 0) {
+      absl::Status status =
+          SubmitPollAdd(handle->WrappedFd(), kPollEvents, user_data);
+      handle->PollArmed() = status.ok();
+      if (!status.ok()) {
+        LOG(ERROR) << "io_uring poll re-arm failed for fd "
+                   << handle->WrappedFd() << ": " << status;
+        QueueRetry(handle, IoUringEventHandle::kRetryPollAdd);
+      }
+    } else if (res < 0) {
+      LOG(ERROR) << "io_uring poll failed for fd " << handle->WrappedFd()
+                 << ": " << grpc_core::StrError(-res);
+    }
+  }
+  __atomic_store_n(ring_.cq_head, head, __ATOMIC_RELEASE);
+  return was_kicked;
+}
+
+// Waits for completions and returns the number of completions available in
+// the completion ring. Completions are not "processed" yet; that is done in
+// ProcessCompletions().
+int IoUringPoller::WaitForCompletions(EventEngine::Duration timeout) {
+  unsigned head = *ring_.cq_head;
+  unsigned tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  if (head != tail) {
+    return static_cast<int>(tail - head);
+  }
+  timeout = std::max(timeout, EventEngine::Duration::zero());
+  auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+  KernelTimespec ts;
+  ts.tv_sec = seconds.count();
+  ts.tv_nsec =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - seconds)
+          .count();
+  GetEventsArg arg;
+  memset(&arg, 0, sizeof(arg));
+  arg.ts = reinterpret_cast<uint64_t>(&ts);
+  int r;
+  do {
+    r = IoUringEnter(ring_.ring_fd, 0, 1,
+                     IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                     sizeof(arg));
+  } while (r < 0 && errno == EINTR);
+  // ETIME means the timeout expired. EBUSY means completions are backlogged
+  // in the kernel and will be flushed to the ring by the next wait.
+  if (r < 0 && errno != ETIME && errno != EBUSY) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+  tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  return static_cast<int>(tail - head);
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  grpc_core::MutexLock poller_lock(&poller_->mu_);
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+  CancelMsgOps();
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+// Waits for completions until timeout is reached or there is a Kick(). If
+// there is a Kick(), it collects and processes any previously un-processed
+// completions. If there are no un-processed completions, it returns
+// Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (!RetryFailedSubmissions()) {
+      // Come back for the remaining submissions even if nothing completes.
+      timeout = std::min(timeout, kSubmitRetryInterval);
+    }
+  }
+  if (WaitForCompletions(timeout) == 0) {
+    return Poller::WorkResult::kDeadlineExceeded;
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    // If was_kicked_ is true, collect all pending completions in this
+    // iteration.
+    if (ProcessCompletions(
+            was_kicked_ ? INT_MAX : MAX_IO_URING_CQES_HANDLED_PER_ITERATION,
+            pending_events)) {
+      was_kicked_ = false;
+      was_kicked_ext = true;
+    }
+    if (pending_events.empty()) {
+      return Poller::WorkResult::kKicked;
+    }
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler) {
+  // Fork support is only implemented by the epoll1 and poll pollers.
+  if (grpc_core::Fork::Enabled()) {
+    return nullptr;
+  }
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (!kIoUringPollerSupported) {
+    return nullptr;
+  }
+  auto poller = std::make_shared<IoUringPoller>(scheduler);
+  if (!poller->Ok()) {
+    return nullptr;
+  }
+  return poller;
+}
+
+void IoUringPoller::PrepareFork() { Kick(); }
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#else  // defined(GRPC_LINUX_IO_URING)
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// If GRPC_LINUX_IO_URING is not defined, it means io_uring is not available.
+// Return nullptr.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // !defined(GRPC_LINUX_IO_URING)
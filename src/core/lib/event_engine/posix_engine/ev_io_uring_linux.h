@@ -0,0 +1,200 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/port.h"
+
+#define MAX_IO_URING_CQES_HANDLED_PER_ITERATION 256
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct msghdr;
+
+namespace grpc_event_engine {
+namespace experimental {
+
+class IoUringEventHandle;
+
+// Definition of an io_uring based poller.
+//
+// Readiness is tracked with multishot IORING_OP_POLL_ADD requests, so an fd is
+// armed once when its handle is created and stays armed until it is orphaned.
+// This gives the same edge-triggered semantics as the epoll1 poller, while
+// completions for all ready fds are reaped from the shared completion ring
+// without a syscall per event.
+//
+// Handles additionally accept recvmsg and sendmsg requests
+// (EventHandle::SubmitRecvmsg/SubmitSendmsg), which the kernel runs once the
+// socket is ready instead of the endpoint waiting for readiness and then
+// issuing the syscall itself.
+//
+// Submissions can fail transiently, e.g. with EBUSY while the kernel holds
+// completions which did not fit into the completion ring. Poll requests and
+// cancellations which could not be submitted are retried from Work().
+class IoUringPoller : public PosixEventPoller {
+ public:
+  explicit IoUringPoller(Scheduler* scheduler);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  void Shutdown() override;
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  bool CanSubmitMsgOps() const override { return true; }
+  ~IoUringPoller() override;
+
+  // Forkable
+  void PrepareFork() override;
+  void PostforkParent() override;
+  void PostforkChild() override;
+
+  void Close();
+
+  // Returns true if the ring was set up successfully. A poller which failed
+  // to set up its ring must not be used.
+  bool Ok() const { return ring_.ring_fd >= 0; }
+
+ private:
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+  friend class IoUringEventHandle;
+
+#ifdef GRPC_LINUX_IO_URING
+  struct Ring {
+    int ring_fd = -1;
+    // Submission queue.
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_array = nullptr;
+    io_uring_sqe* sqes = nullptr;
+    // Completion queue.
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    // Both rings share a single mapping (IORING_FEAT_SINGLE_MMAP); the
+    // submission queue entries live in a second one.
+    void* ring_ptr = nullptr;
+    size_t ring_size = 0;
+    void* sqes_ptr = nullptr;
+    size_t sqes_size = 0;
+  };
+#else
+  struct Ring {
+    int ring_fd = -1;
+  };
+#endif
+
+  // Sets up the submission and completion rings. Returns false if the kernel
+  // does not support the io_uring features this poller depends on.
+  bool SetupRing();
+  // Fills in a single submission queue entry with prepare() and submits it to
+  // the kernel. If the kernel does not accept the entry, it is taken back off
+  // the submission queue and an error is returned.
+  absl::Status SubmitSqe(absl::FunctionRef<void(io_uring_sqe*)> prepare);
+  // Queues a multishot poll request for the given events on fd, tagged with
+  // user_data, and submits it to the kernel.
+  absl::Status SubmitPollAdd(int fd, uint32_t events, uint64_t user_data);
+  // Cancels the poll request tagged with user_data. The cancelled request
+  // posts a final completion without IORING_CQE_F_MORE.
+  absl::Status SubmitPollRemove(uint64_t user_data);
+  // Cancels the recvmsg or sendmsg request tagged with user_data, which then
+  // completes with -ECANCELED unless it already completed.
+  absl::Status SubmitCancel(uint64_t user_data);
+  // Submits a recvmsg or sendmsg request on fd, tagged with user_data.
+  absl::Status SubmitMsgOp(uint8_t opcode, int fd, struct msghdr* msg,
+                           uint32_t flags, uint64_t user_data);
+  // Remembers that the requests in ops (a mask of IoUringEventHandle::kRetry*
+  // bits) could not be submitted for handle, so that Work() retries them.
+  void QueueRetry(IoUringEventHandle* handle, uint8_t ops)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Forgets the requests in ops which no longer need to be retried.
+  void DequeueRetry(IoUringEventHandle* handle, uint8_t ops)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Retries submissions which failed earlier. Returns false if some of them
+  // still could not be submitted.
+  bool RetryFailedSubmissions() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Moves an orphaned handle to the free list once the kernel holds no more
+  // requests referring to it.
+  void MaybeRecycleHandle(IoUringEventHandle* handle)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Blocks until at least one completion is available or the timeout
+  // expires. Returns the number of completions ready to be reaped.
+  int WaitForCompletions(
+      grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Reaps up to max_cqes_to_handle completions from the completion ring and
+  // converts them into pending actions on the corresponding handles. Returns
+  // true if there was a Kick that forced invocation of this function.
+  bool ProcessCompletions(int max_cqes_to_handle, Events& pending_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  grpc_core::Mutex mu_;
+  // Serializes writers of the submission ring.
+  grpc_core::Mutex sq_mu_;
+  Scheduler* scheduler_;
+  Ring ring_;
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  // Handles which have been orphaned but whose poll request has not yet
+  // posted its final completion. They are moved to the free list once it
+  // arrives, which guarantees no stale completion refers to a reused handle.
+  std::list<EventHandle*> orphaned_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  // Handles with requests which could not be submitted, see QueueRetry.
+  std::list<EventHandle*> retry_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+  // False while the poll request watching wakeup_fd_ needs to be resubmitted.
+  bool wakeup_poll_armed_ ABSL_GUARDED_BY(mu_) = false;
+  bool closed_;
+};
+
+// Return an instance of an io_uring based poller tied to the specified
+// scheduler, or nullptr if the running kernel does not support it.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler);
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
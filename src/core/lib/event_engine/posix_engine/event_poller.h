@@ -27,6 +27,8 @@
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 
+struct msghdr;
+
 namespace grpc_event_engine {
 namespace experimental {
 
@@ -81,6 +83,22 @@ class EventHandle {
   virtual void SetHasError() = 0;
   // Returns true if the handle has been shutdown.
   virtual bool IsHandleShutdown() = 0;
+  // Pollers which can perform socket I/O themselves override these to run a
+  // recvmsg or sendmsg on the underlying file descriptor once it is ready.
+  // on_done is run with the result of the call, or a negative errno, when it
+  // completes; msg and the buffers it refers to must stay valid until then.
+  // At most one request of each kind may be pending at a time, and pending
+  // requests complete with -ECANCELED when the handle is shutdown. Returns
+  // false, dropping on_done, if the request could not be submitted, in which
+  // case the caller should fall back to NotifyOnRead/NotifyOnWrite.
+  virtual bool SubmitRecvmsg(struct msghdr* /*msg*/,
+                             absl::AnyInvocable<void(int)> /*on_done*/) {
+    return false;
+  }
+  virtual bool SubmitSendmsg(struct msghdr* /*msg*/, int /*flags*/,
+                             absl::AnyInvocable<void(int)> /*on_done*/) {
+    return false;
+  }
   // Returns the poller which was used to create this handle.
   virtual PosixEventPoller* Poller() = 0;
   virtual ~EventHandle() = default;
@@ -93,6 +111,9 @@ class PosixEventPoller : public grpc_event_engine::experimental::Poller,
   virtual EventHandle* CreateHandle(int fd, absl::string_view name,
                                     bool track_err) = 0;
   virtual bool CanTrackErrors() const = 0;
+  // Returns true if the handles created by this poller implement
+  // EventHandle::SubmitRecvmsg and EventHandle::SubmitSendmsg.
+  virtual bool CanSubmitMsgOps() const { return false; }
   virtual std::string Name() = 0;
   // Shuts down and deletes the poller. It is legal to call this function
   // only when no other poller method is in progress. For instance, it is
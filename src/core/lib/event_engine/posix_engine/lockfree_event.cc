@@ -202,6 +202,11 @@ bool LockfreeEvent::SetShutdown(absl::Status shutdown_error) {
 }
 
 void LockfreeEvent::SetReady() {
+  PosixEngineClosure* closure = SetReadyAndTakeClosure();
+  if (closure != nullptr) scheduler_->Run(closure);
+}
+
+PosixEngineClosure* LockfreeEvent::SetReadyAndTakeClosure() {
   // The load() needs to be performed only once before entry
   // into the loop. This is because if any of the compare_exchange_strong
   // operations inside the loop return false, they automatically update curr
@@ -211,14 +216,14 @@ void LockfreeEvent::SetReady() {
     switch (curr) {
       case kClosureReady: {
         // Already ready. We are done here.
-        return;
+        return nullptr;
       }
 
       case kClosureNotReady: {
         if (state_.compare_exchange_strong(curr, kClosureReady,
                                            std::memory_order_acq_rel,
                                            std::memory_order_acquire)) {
-          return;  // early out
+          return nullptr;  // early out
         }
         break;  // retry
       }
@@ -227,7 +232,7 @@ void LockfreeEvent::SetReady() {
         // 'curr' is either a closure or the fd is shutdown
         if ((curr & kShutdownBit) > 0) {
           // The fd is shutdown. Do nothing.
-          return;
+          return nullptr;
         } else if (state_.compare_exchange_strong(curr, kClosureNotReady,
                                                   std::memory_order_acq_rel,
                                                   std::memory_order_acquire)) {
@@ -236,14 +241,13 @@ void LockfreeEvent::SetReady() {
           // notify_on (or set_shutdown)
           auto closure = reinterpret_cast<PosixEngineClosure*>(curr);
           closure->SetStatus(absl::OkStatus());
-          scheduler_->Run(closure);
-          return;
+          return closure;
         }
         // else the state changed again (only possible by either a racing
         // set_ready or set_shutdown functions. In both these cases, the
         // closure would have been scheduled for execution. So we are done
         // here
-        return;
+        return nullptr;
       }
     }
   }
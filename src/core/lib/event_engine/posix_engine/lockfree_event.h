@@ -60,6 +60,11 @@ class LockfreeEvent {
   // Signals that the event has been received.
   void SetReady();
 
+  // Like SetReady(), but instead of scheduling the closure waiting for the
+  // event, if any, returns it for the caller to run. Returns nullptr if no
+  // closure was waiting.
+  PosixEngineClosure* SetReadyAndTakeClosure();
+
  private:
   enum State { kClosureNotReady = 0, kClosureReady = 2, kShutdownBit = 1 };
 
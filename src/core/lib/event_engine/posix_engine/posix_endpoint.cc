@@ -36,6 +36,7 @@
 #include <grpc/event_engine/internal/slice_cast.h>
 #include <grpc/event_engine/slice.h>
 #include <grpc/event_engine/slice_buffer.h>
+#include <grpc/slice.h>
 #include <grpc/status.h>
 #include <grpc/support/port_platform.h>
 
@@ -65,6 +66,10 @@
 #include <sys/prctl.h>         // IWYU pragma: keep
 #include <sys/resource.h>      // IWYU pragma: keep
 #endif
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+#include <sys/mman.h>  // IWYU pragma: keep
+#include <unistd.h>    // IWYU pragma: keep
+#endif
 #include <netinet/in.h>  // IWYU pragma: keep
 
 #ifndef SOL_TCP
@@ -91,6 +96,12 @@
 #define MSG_ZEROCOPY 0x4000000
 #endif
 
+// TCP zero copy receive socket option. Defined here for the same reason as
+// MSG_ZEROCOPY above.
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+
 #define MAX_READ_IOVEC 64
 
 namespace grpc_event_engine {
@@ -217,8 +228,82 @@ absl::Status PosixOSError(int error_no, absl::string_view call_name) {
       call_name, ": ", grpc_core::StrError(error_no), " (", error_no, ")"));
 }
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+// Upper bound on the number of bytes mapped by a single zerocopy receive.
+constexpr size_t kMaxZerocopyReceiveLength = 16 * 1024 * 1024;
+
+// Leading fields of the kernel's struct tcp_zerocopy_receive, which is not
+// declared by older library headers. The kernel accepts any option length
+// that covers at least these fields.
+struct TcpZerocopyReceiveArgs {
+  uint64_t address;
+  uint32_t length;
+  uint32_t recv_skip_hint;
+};
+
+// Number of unused regions an endpoint keeps mapped for later receives.
+constexpr size_t kMaxFreeZerocopyReceiveRegions = 4;
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
 }  // namespace
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+// An address range of kMaxZerocopyReceiveLength bytes mapped from the socket,
+// which TCP_ZEROCOPY_RECEIVE maps received pages into.
+struct TcpZerocopyReceiveRegion {
+  void* addr;
+  // Set while a slice refers to the pages mapped into the region.
+  grpc_core::RefCountedPtr<TcpZerocopyReceiveRegions> owner;
+  absl::optional<grpc_core::MemoryAllocator::Reservation> reservation;
+};
+
+TcpZerocopyReceiveRegions::~TcpZerocopyReceiveRegions() {
+  for (TcpZerocopyReceiveRegion* region : free_regions_) {
+    munmap(region->addr, kMaxZerocopyReceiveLength);
+    delete region;
+  }
+}
+
+TcpZerocopyReceiveRegion* TcpZerocopyReceiveRegions::Get() {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (!free_regions_.empty()) {
+      TcpZerocopyReceiveRegion* region = free_regions_.back();
+      free_regions_.pop_back();
+      return region;
+    }
+  }
+  void* addr =
+      mmap(nullptr, kMaxZerocopyReceiveLength, PROT_READ, MAP_SHARED, fd_, 0);
+  if (addr == MAP_FAILED) return nullptr;
+  return new TcpZerocopyReceiveRegion{addr, nullptr, absl::nullopt};
+}
+
+void TcpZerocopyReceiveRegions::Put(TcpZerocopyReceiveRegion* region) {
+  // Drop the received pages right away rather than when the region is next
+  // used.
+  madvise(region->addr, kMaxZerocopyReceiveLength, MADV_DONTNEED);
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_regions_.size() < kMaxFreeZerocopyReceiveRegions) {
+      free_regions_.push_back(region);
+      return;
+    }
+  }
+  munmap(region->addr, kMaxZerocopyReceiveLength);
+  delete region;
+}
+
+void TcpZerocopyReceiveRegions::ReleaseSliceRegion(void* arg) {
+  auto* region = static_cast<TcpZerocopyReceiveRegion*>(arg);
+  region->reservation.reset();
+  // The region may be the last reference to its owner.
+  grpc_core::RefCountedPtr<TcpZerocopyReceiveRegions> owner =
+      std::move(region->owner);
+  owner->Put(region);
+}
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
 #if defined(IOV_MAX) && IOV_MAX < 260
 #define MAX_WRITE_IOVEC IOV_MAX
 #else
@@ -311,6 +396,29 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   CHECK_NE(incoming_buffer_->Length(), 0u);
   DCHECK_GT(min_progress_size_, 0);
 
+  if (tcp_zerocopy_recv_enabled_ &&
+      std::max(min_progress_size_, inq_) >= tcp_zerocopy_recv_threshold_) {
+    // Map the page-aligned part of the payload first. The mapped bytes precede
+    // anything still queued on the socket, so they are staged in
+    // last_read_buffer_ exactly like a partial read with frame size tuning.
+    size_t mapped = TcpZerocopyReceive(std::max(min_progress_size_, inq_),
+                                       last_read_buffer_);
+    if (mapped > 0) {
+      AddToEstimate(mapped);
+      if (!grpc_core::IsTcpFrameSizeTuningEnabled() ||
+          (min_progress_size_ -= mapped) <= 0) {
+        // Deliver just the mapped bytes. The unaligned tail, if any, is left
+        // on the socket for the next read, and the unused read slices are
+        // kept in last_read_buffer_ for that read to reuse.
+        min_progress_size_ = 1;
+        incoming_buffer_->Swap(last_read_buffer_);
+        status = absl::OkStatus();
+        return true;
+      }
+      // Not enough bytes to make progress yet: fall back to copying the rest.
+    }
+  }
+
   do {
     // Assume there is something on the queue. If we receive TCP_INQ from
     // kernel, we will update this value, otherwise, we have to assume there is
@@ -416,7 +524,11 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     // edge event could cause the next read to wait indefinitely.
     inq_ = 1;
   }
+  return FinishRead(total_read_bytes, status);
+}
 
+bool PosixEndpointImpl::FinishRead(size_t total_read_bytes,
+                                   absl::Status& status) {
   DCHECK_GT(total_read_bytes, 0u);
   status = absl::OkStatus();
   if (grpc_core::IsTcpFrameSizeTuningEnabled()) {
@@ -452,6 +564,63 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   return true;
 }
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+size_t PosixEndpointImpl::TcpZerocopyReceive(size_t length, SliceBuffer& dest) {
+  static const size_t kPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  length = std::min(length, kMaxZerocopyReceiveLength) / kPageSize * kPageSize;
+  if (length == 0) return 0;
+  if (zerocopy_recv_regions_ == nullptr) {
+    zerocopy_recv_regions_ =
+        grpc_core::MakeRefCounted<TcpZerocopyReceiveRegions>(fd_);
+  }
+  // The kernel remaps pages from the receive queue into the region.
+  TcpZerocopyReceiveRegion* region = zerocopy_recv_regions_->Get();
+  if (region == nullptr) {
+    VLOG(2) << "Rx zero-copy disabled: mmap failed fd=" << fd_
+            << " errno=" << errno;
+    tcp_zerocopy_recv_enabled_ = false;
+    return 0;
+  }
+  TcpZerocopyReceiveArgs zc;
+  memset(&zc, 0, sizeof(zc));
+  zc.address = reinterpret_cast<uintptr_t>(region->addr);
+  zc.length = static_cast<uint32_t>(length);
+  socklen_t zc_len = sizeof(zc);
+  if (getsockopt(fd_, IPPROTO_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_len) != 0) {
+    int saved_errno = errno;
+    zerocopy_recv_regions_->Put(region);
+    if (saved_errno == ENOPROTOOPT || saved_errno == EINVAL ||
+        saved_errno == EOPNOTSUPP) {
+      VLOG(2) << "Rx zero-copy disabled: getsockopt failed fd=" << fd_
+              << " errno=" << saved_errno;
+      tcp_zerocopy_recv_enabled_ = false;
+    }
+    return 0;
+  }
+  if (zc.length == 0) {
+    zerocopy_recv_regions_->Put(region);
+    return 0;
+  }
+  // If everything requested was mapped there is likely more of the same
+  // payload queued; otherwise the skip hint is what must be copied next.
+  inq_ = zc.length == length ? static_cast<int>(length)
+                             : std::max<int>(1, zc.recv_skip_hint);
+  // The mapped pages are charged to the endpoint like copied read slices,
+  // until the slice is released and the region goes back to the endpoint.
+  region->reservation.emplace(memory_owner_.MakeReservation(zc.length));
+  region->owner = zerocopy_recv_regions_;
+  dest.Append(Slice(grpc_slice_new_with_user_data(
+      region->addr, zc.length, TcpZerocopyReceiveRegions::ReleaseSliceRegion,
+      region)));
+  return zc.length;
+}
+#else   // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+size_t PosixEndpointImpl::TcpZerocopyReceive(size_t /*length*/,
+                                             SliceBuffer& /*dest*/) {
+  return 0;
+}
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
 void PosixEndpointImpl::PerformReclamation() {
   read_mu_.Lock();
   if (incoming_buffer_ != nullptr) {
@@ -567,11 +736,85 @@ bool PosixEndpointImpl::HandleReadLocked(absl::Status& status) {
 
 void PosixEndpointImpl::HandleRead(absl::Status status) {
   bool ret = false;
+  bool submitted = false;
   absl::AnyInvocable<void(absl::Status)> cb = nullptr;
   grpc_core::EnsureRunInExecCtx([&, this]() mutable {
     grpc_core::MutexLock lock(&read_mu_);
     ret = HandleReadLocked(status);
-    if (ret) {
+    if (!ret) {
+      submitted = SubmitRingRead();
+    } else {
+      GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+          << "Endpoint[" << this << "]: Read complete";
+      cb = std::move(read_cb_);
+      read_cb_ = nullptr;
+      incoming_buffer_ = nullptr;
+    }
+  });
+  if (!ret) {
+    if (!submitted) {
+      handle_->NotifyOnRead(on_read_);
+    }
+    return;
+  }
+  cb(status);
+  Unref();
+}
+
+bool PosixEndpointImpl::SubmitRingRead() {
+  if (!ring_io_enabled_ || !memory_owner_.is_valid()) {
+    return false;
+  }
+  MaybeMakeReadSlices();
+  size_t iov_len = std::min<size_t>(MAX_READ_IOVEC, incoming_buffer_->Count());
+  ring_read_iov_.resize(iov_len);
+  for (size_t i = 0; i < iov_len; i++) {
+    MutableSlice& slice =
+        internal::SliceCast<MutableSlice>(incoming_buffer_->MutableSliceAt(i));
+    ring_read_iov_[i].iov_base = slice.begin();
+    ring_read_iov_[i].iov_len = slice.length();
+  }
+  memset(&ring_read_msg_, 0, sizeof(ring_read_msg_));
+  ring_read_msg_.msg_iov = ring_read_iov_.data();
+  ring_read_msg_.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
+  // The pending read holds the reference taken by Read().
+  return handle_->SubmitRecvmsg(
+      &ring_read_msg_, [this](int result) { HandleRingRead(result); });
+}
+
+void PosixEndpointImpl::HandleRingRead(int result) {
+  absl::Status status;
+  bool ret = false;
+  bool submitted = false;
+  absl::AnyInvocable<void(absl::Status)> cb = nullptr;
+  grpc_core::EnsureRunInExecCtx([&, this]() mutable {
+    grpc_core::MutexLock lock(&read_mu_);
+    if (result > 0) {
+      AddToEstimate(static_cast<size_t>(result));
+      FinishEstimate();
+      // The kernel does not report TCP_INQ for this read, so assume more
+      // is queued, like after a partial read.
+      inq_ = 1;
+      ret = FinishRead(static_cast<size_t>(result), status);
+      if (!ret) {
+        // More bytes are needed to make progress; they may already be here.
+        ret = HandleReadLocked(status);
+      }
+    } else if (result == 0) {
+      incoming_buffer_->Clear();
+      status = TcpAnnotateError(absl::InternalError("Socket closed"));
+      ret = true;
+    } else if (result != -EAGAIN && result != -EINTR &&
+               result != -ECANCELED) {
+      incoming_buffer_->Clear();
+      status = TcpAnnotateError(PosixOSError(-result, "recvmsg"));
+      ret = true;
+    }
+    // A read cancelled by ShutdownHandle cannot be resubmitted, and
+    // NotifyOnRead then reports the shutdown.
+    if (!ret) {
+      submitted = SubmitRingRead();
+    } else {
       GRPC_TRACE_LOG(event_engine_endpoint, INFO)
           << "Endpoint[" << this << "]: Read complete";
       cb = std::move(read_cb_);
@@ -580,7 +823,9 @@ void PosixEndpointImpl::HandleRead(absl::Status status) {
     }
   });
   if (!ret) {
-    handle_->NotifyOnRead(on_read_);
+    if (!submitted) {
+      handle_->NotifyOnRead(on_read_);
+    }
     return;
   }
   cb(status);
@@ -609,15 +854,17 @@ bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
     // Endpoint read called for the very first time. Register read callback
     // with the polling engine.
     is_first_read_ = false;
+    bool submitted = SubmitRingRead();
     lock.Release();
-    handle_->NotifyOnRead(on_read_);
+    if (!submitted) handle_->NotifyOnRead(on_read_);
   } else if (inq_ == 0) {
     read_cb_ = std::move(on_read);
     UpdateRcvLowat();
+    bool submitted = SubmitRingRead();
     lock.Release();
     // Upper layer asked to read more but we know there is no pending data to
     // read from previous reads. So, wait for POLLIN.
-    handle_->NotifyOnRead(on_read_);
+    if (!submitted) handle_->NotifyOnRead(on_read_);
   } else {
     absl::Status status;
     MaybeMakeReadSlices();
@@ -625,8 +872,9 @@ bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
       UpdateRcvLowat();
       read_cb_ = std::move(on_read);
       // We've consumed the edge, request a new one.
+      bool submitted = SubmitRingRead();
       lock.Release();
-      handle_->NotifyOnRead(on_read_);
+      if (!submitted) handle_->NotifyOnRead(on_read_);
       return false;
     }
     if (!status.ok()) {
@@ -1137,7 +1385,9 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
                           : TcpFlush(status);
   if (!flush_result) {
     DCHECK(status.ok());
-    handle_->NotifyOnWrite(on_write_);
+    if (!SubmitRingWrite()) {
+      handle_->NotifyOnWrite(on_write_);
+    }
   } else {
     GRPC_TRACE_LOG(event_engine_endpoint, INFO)
         << "Endpoint[" << this << "]: Write complete: " << status;
@@ -1149,6 +1399,66 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
   }
 }
 
+bool PosixEndpointImpl::SubmitRingWrite() {
+  // Zerocopy sends and sends collecting timestamps need control messages and
+  // the error queue, so they keep waiting for writability.
+  if (!ring_io_enabled_ || current_zerocopy_send_ != nullptr ||
+      outgoing_buffer_arg_ != nullptr) {
+    return false;
+  }
+  size_t iov_len = std::min<size_t>(MAX_WRITE_IOVEC, outgoing_buffer_->Count());
+  ring_write_iov_.resize(iov_len);
+  for (size_t i = 0; i < iov_len; i++) {
+    MutableSlice& slice =
+        internal::SliceCast<MutableSlice>(outgoing_buffer_->MutableSliceAt(i));
+    size_t skip = i == 0 ? outgoing_byte_idx_ : 0;
+    ring_write_iov_[i].iov_base = slice.begin() + skip;
+    ring_write_iov_[i].iov_len = slice.length() - skip;
+  }
+  memset(&ring_write_msg_, 0, sizeof(ring_write_msg_));
+  ring_write_msg_.msg_iov = ring_write_iov_.data();
+  ring_write_msg_.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
+  // The pending write holds the reference taken by Write().
+  return handle_->SubmitSendmsg(
+      &ring_write_msg_, SENDMSG_FLAGS,
+      [this](int result) { HandleRingWrite(result); });
+}
+
+void PosixEndpointImpl::HandleRingWrite(int result) {
+  if (result == -ECANCELED) {
+    // Cancelled by ShutdownHandle; NotifyOnWrite reports the shutdown.
+    handle_->NotifyOnWrite(on_write_);
+    return;
+  }
+  if (result == -EAGAIN || result == -ENOBUFS || result == -EINTR) {
+    HandleWrite(absl::OkStatus());
+    return;
+  }
+  if (result < 0) {
+    outgoing_buffer_->Clear();
+    TcpShutdownTracedBufferList();
+    HandleWrite(TcpAnnotateError(PosixOSError(-result, "sendmsg")));
+    return;
+  }
+  bytes_counter_ += result;
+  // Drop what was sent, including the part of the first slice which had been
+  // sent before.
+  SliceBuffer sent;
+  outgoing_buffer_->MoveFirstNBytesIntoSliceBuffer(
+      outgoing_byte_idx_ + static_cast<size_t>(result), sent);
+  outgoing_byte_idx_ = 0;
+  if (outgoing_buffer_->Length() != 0) {
+    HandleWrite(absl::OkStatus());
+    return;
+  }
+  GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+      << "Endpoint[" << this << "]: Write complete";
+  absl::AnyInvocable<void(absl::Status)> cb_ = std::move(write_cb_);
+  write_cb_ = nullptr;
+  cb_(absl::OkStatus());
+  Unref();
+}
+
 bool PosixEndpointImpl::Write(
     absl::AnyInvocable<void(absl::Status)> on_writable, SliceBuffer* data,
     const EventEngine::Endpoint::WriteArgs* args) {
@@ -1199,7 +1509,9 @@ bool PosixEndpointImpl::Write(
     Ref().release();
     write_cb_ = std::move(on_writable);
     current_zerocopy_send_ = zerocopy_send_record;
-    handle_->NotifyOnWrite(on_write_);
+    if (!SubmitRingWrite()) {
+      handle_->NotifyOnWrite(on_write_);
+    }
     return false;
   }
   if (!status.ok()) {
@@ -1311,9 +1623,15 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
     }
   }
 #endif  // GRPC_LINUX_ERRQUEUE
+  ring_io_enabled_ = poller_->CanSubmitMsgOps();
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
       options.tcp_tx_zerocopy_send_bytes_threshold);
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  tcp_zerocopy_recv_enabled_ = options.tcp_rx_zero_copy_enabled;
+  tcp_zerocopy_recv_threshold_ =
+      std::max(options.tcp_rx_zerocopy_receive_bytes_threshold, 1);
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(fd_, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
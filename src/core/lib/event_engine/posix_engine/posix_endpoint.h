@@ -24,6 +24,7 @@
 #include <memory>
 #include <new>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
@@ -47,6 +48,7 @@
 #include "src/core/lib/event_engine/posix_engine/traced_buffer_list.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
@@ -464,6 +466,33 @@ class TcpZerocopySendCtx {
   OptMemState zcopy_enobuf_state_ ABSL_GUARDED_BY(mu_) = OptMemState::kOpen;
 };
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+struct TcpZerocopyReceiveRegion;
+
+// The address ranges an endpoint maps from its socket for TCP zerocopy
+// receive. A range is reused once the slice holding the pages received into
+// it is released, instead of mapping a new range for every receive. Shared by
+// the endpoint and the slices it handed out, which may outlive it.
+class TcpZerocopyReceiveRegions
+    : public grpc_core::RefCounted<TcpZerocopyReceiveRegions> {
+ public:
+  explicit TcpZerocopyReceiveRegions(int fd) : fd_(fd) {}
+  ~TcpZerocopyReceiveRegions() override;
+
+  // Returns an unused region, or nullptr if a new one could not be mapped.
+  TcpZerocopyReceiveRegion* Get();
+  // Returns a region which no slice refers to anymore.
+  void Put(TcpZerocopyReceiveRegion* region);
+  // Destroy function of the slices handed out for a region.
+  static void ReleaseSliceRegion(void* region);
+
+ private:
+  const int fd_;
+  grpc_core::Mutex mu_;
+  std::vector<TcpZerocopyReceiveRegion*> free_regions_ ABSL_GUARDED_BY(mu_);
+};
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
 class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
  public:
   PosixEndpointImpl(
@@ -508,6 +537,26 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Hands total_read_bytes newly read into incoming_buffer_ to the pending
+  // read. Returns false if more bytes are needed to make progress.
+  bool FinishRead(size_t total_read_bytes, absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // With pollers which run recvmsg themselves (see
+  // PosixEventPoller::CanSubmitMsgOps), submits a recvmsg into
+  // incoming_buffer_ instead of waiting for readability. Returns false if the
+  // caller has to call NotifyOnRead instead.
+  bool SubmitRingRead() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void HandleRingRead(int result) ABSL_NO_THREAD_SAFETY_ANALYSIS;
+  // Like SubmitRingRead, for sending outgoing_buffer_.
+  bool SubmitRingWrite();
+  void HandleRingWrite(int result);
+  // Maps up to length page-aligned bytes from the socket receive queue with
+  // TCP_ZEROCOPY_RECEIVE and appends them to dest. Returns the number of bytes
+  // mapped, which is 0 if nothing could be mapped and the caller should fall
+  // back to copying.
+  size_t TcpZerocopyReceive(size_t length,
+                            grpc_event_engine::experimental::SliceBuffer& dest)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
@@ -553,11 +602,29 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int inq_ = 1;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
+  // Whether large reads should try TCP_ZEROCOPY_RECEIVE first. Cleared if the
+  // kernel turns out not to support it on this socket.
+  bool tcp_zerocopy_recv_enabled_ = false;
+  // Minimum number of expected bytes for a read to attempt a zerocopy receive.
+  int tcp_zerocopy_recv_threshold_ = 0;
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  // Created on the first zerocopy receive.
+  grpc_core::RefCountedPtr<TcpZerocopyReceiveRegions> zerocopy_recv_regions_;
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
 
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
   size_t outgoing_byte_idx_ = 0;
 
+  // Whether reads and writes submit recvmsg/sendmsg to the poller.
+  bool ring_io_enabled_ = false;
+  // Arguments of the pending recvmsg/sendmsg submitted to the poller, which
+  // must stay valid until they complete.
+  struct msghdr ring_read_msg_ ABSL_GUARDED_BY(read_mu_);
+  std::vector<struct iovec> ring_read_iov_ ABSL_GUARDED_BY(read_mu_);
+  struct msghdr ring_write_msg_;
+  std::vector<struct iovec> ring_write_iov_;
+
   PosixEngineClosure* on_read_ = nullptr;
   PosixEngineClosure* on_write_ = nullptr;
   PosixEngineClosure* on_error_ = nullptr;
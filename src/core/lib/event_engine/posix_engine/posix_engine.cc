@@ -50,8 +50,10 @@
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/utils.h"
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/gprpp/sync.h"
+#include "src/core/util/latent_see.h"
 #include "src/core/util/useful.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
@@ -92,6 +94,15 @@ class TimerForkCallbackMethods {
   static void PostforkChild() { g_timer_fork_manager->PostforkChild(); }
 };
 
+// GRPC_POSIX_TIMER_LIST=wheel selects the timing wheel timer list.
+TimerListKind TimerListKindFromEnv() {
+  auto value = grpc_core::GetEnv("GRPC_POSIX_TIMER_LIST");
+  if (value.has_value() && *value == "wheel") {
+    return TimerListKind::kTimingWheel;
+  }
+  return TimerListKind::kHeap;
+}
+
 }  // namespace
 
 #ifdef GRPC_POSIX_SOCKET_TCP
@@ -362,7 +373,8 @@ PosixEnginePollerManager::~PosixEnginePollerManager() {
 PosixEventEngine::PosixEventEngine(std::shared_ptr<PosixEventPoller> poller)
     : connection_shards_(std::max(2 * gpr_cpu_num_cores(), 1u)),
       executor_(MakeThreadPool(grpc_core::Clamp(gpr_cpu_num_cores(), 4u, 16u))),
-      timer_manager_(std::make_shared<TimerManager>(executor_)) {
+      timer_manager_(std::make_shared<TimerManager>(executor_,
+                                                    TimerListKindFromEnv())) {
   g_timer_fork_manager->RegisterForkable(
       timer_manager_, TimerForkCallbackMethods::Prefork,
       TimerForkCallbackMethods::PostforkParent,
@@ -375,7 +387,8 @@ PosixEventEngine::PosixEventEngine(std::shared_ptr<PosixEventPoller> poller)
 PosixEventEngine::PosixEventEngine()
     : connection_shards_(std::max(2 * gpr_cpu_num_cores(), 1u)),
       executor_(MakeThreadPool(grpc_core::Clamp(gpr_cpu_num_cores(), 4u, 16u))),
-      timer_manager_(std::make_shared<TimerManager>(executor_)) {
+      timer_manager_(std::make_shared<TimerManager>(executor_,
+                                                    TimerListKindFromEnv())) {
   g_timer_fork_manager->RegisterForkable(
       timer_manager_, TimerForkCallbackMethods::Prefork,
       TimerForkCallbackMethods::PostforkParent,
@@ -440,6 +453,7 @@ struct PosixEventEngine::ClosureData final : public EventEngine::Closure {
       grpc_core::MutexLock lock(&engine->mu_);
       engine->known_handles_.erase(handle);
     }
+    GRPC_LATENT_SEE_PARENT_SCOPE("PosixEventEngine::ClosureData::Run");
     cb();
     delete this;
   }
@@ -41,6 +41,7 @@
 #include <grpc/event_engine/memory_allocator.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener.h"
@@ -50,10 +51,20 @@
 #include "src/core/lib/gprpp/strerror.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/socket_mutator.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 namespace grpc_event_engine {
 namespace experimental {
 
+namespace {
+// Upper bound on the number of connections accepted in response to a single
+// readiness notification. Once reached, the acceptor yields and re-schedules
+// itself so that a connection storm on one listening socket cannot starve the
+// other closures sharing the poller thread.
+constexpr int kMaxAcceptsPerWakeup = 64;
+}  // namespace
+
 PosixEngineListenerImpl::PosixEngineListenerImpl(
     PosixEventEngineWithFdSupport::PosixAcceptCallback on_accept,
     absl::AnyInvocable<void(absl::Status)> on_shutdown,
@@ -116,7 +127,7 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
 
   auto result = CreateAndPrepareListenerSocket(options_, res_addr);
   GRPC_RETURN_IF_ERROR(result.status());
-  acceptors_.Append(*result);
+  ListenerContainerAppendShardedSocket(acceptors_, options_, *result);
   return result->port;
 }
 
@@ -136,7 +147,17 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
     return;
   }
   // loop until accept4 returns EAGAIN, and then re-arm notification.
+  int accepted = 0;
   for (;;) {
+    if (accepted == kMaxAcceptsPerWakeup) {
+      // There may be more pending connections. Re-arm the notification and
+      // mark the handle readable so that accepting resumes once the poller
+      // has had a chance to run other work.
+      grpc_core::global_stats().IncrementTcpAcceptBatchSize(accepted);
+      handle_->NotifyOnRead(notify_on_accept_);
+      handle_->SetReadable();
+      return;
+    }
     EventEngine::ResolvedAddress addr;
     memset(const_cast<sockaddr*>(addr.address()), 0, addr.size());
     // Note: If we ever decide to return this address to the user, remember to
@@ -174,6 +195,7 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
           return;
         case EAGAIN:
         case ECONNABORTED:
+          grpc_core::global_stats().IncrementTcpAcceptBatchSize(accepted);
           handle_->NotifyOnRead(notify_on_accept_);
           return;
         default:
@@ -205,8 +227,14 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
       addr = EventEngine::ResolvedAddress(addr.address(), len);
     }
 
+    ++accepted;
     PosixSocketWrapper sock(fd);
     (void)sock.SetSocketNoSigpipeIfPossible();
+    const int busy_poll_us = BusyPollBudget::SocketBusyPollMicrosFromEnv();
+    if (busy_poll_us > 0) {
+      auto status = sock.SetSocketBusyPollIfPossible(busy_poll_us);
+      if (!status.ok()) LOG_EVERY_N_SEC(ERROR, 60) << status;
+    }
     auto result = sock.ApplySocketMutatorInOptions(
         GRPC_FD_SERVER_CONNECTION_USAGE, listener_->options_);
     if (!result.ok()) {
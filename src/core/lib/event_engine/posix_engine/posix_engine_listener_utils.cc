@@ -229,6 +229,40 @@ absl::StatusOr<ListenerSocket> CreateAndPrepareListenerSocket(
   return socket;
 }
 
+void ListenerContainerAppendShardedSocket(
+    ListenerSocketsContainer& listener_sockets, const PosixTcpOptions& options,
+    const ListenerSocket& socket) {
+  listener_sockets.Append(socket);
+  if (options.listener_shards <= 1 ||
+      socket.addr.address()->sa_family == AF_UNIX ||
+      ResolvedAddressIsVSock(socket.addr)) {
+    return;
+  }
+  ResolvedAddress addr = socket.addr;
+  ResolvedAddressSetPort(addr, socket.port);
+  int num_shards = 1;
+  for (; num_shards < options.listener_shards; ++num_shards) {
+    auto shard = CreateAndPrepareListenerSocket(options, addr);
+    if (!shard.ok()) {
+      LOG(ERROR) << "Failed to create listener shard " << num_shards << " of "
+                 << options.listener_shards << ": " << shard.status();
+      break;
+    }
+    listener_sockets.Append(*shard);
+  }
+  if (options.listener_cpu_steering && num_shards > 1) {
+    // The program is shared by the whole SO_REUSEPORT group, so attaching it
+    // to any member is enough.
+    PosixSocketWrapper sock = socket.sock;
+    auto status = sock.SetSocketReusePortCpuSteering(num_shards);
+    if (!status.ok()) {
+      VLOG(2) << "Node does not support SO_ATTACH_REUSEPORT_CBPF, "
+                 "continuing without cpu steering: "
+              << status;
+    }
+  }
+}
+
 absl::StatusOr<int> ListenerContainerAddAllLocalAddresses(
     ListenerSocketsContainer& listener_sockets, const PosixTcpOptions& options,
     int requested_port) {
@@ -291,7 +325,7 @@ absl::StatusOr<int> ListenerContainerAddAllLocalAddresses(
                        " due to error: ", result.status().message()));
       break;
     } else {
-      listener_sockets.Append(*result);
+      ListenerContainerAppendShardedSocket(listener_sockets, options, *result);
       assigned_port = result->port;
       no_local_addresses = false;
     }
@@ -328,7 +362,7 @@ absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
   // Try listening on IPv6 first.
   v6_sock = CreateAndPrepareListenerSocket(options, wild6);
   if (v6_sock.ok()) {
-    listener_sockets.Append(*v6_sock);
+    ListenerContainerAppendShardedSocket(listener_sockets, options, *v6_sock);
     requested_port = v6_sock->port;
     assigned_port = v6_sock->port;
     if (v6_sock->dsmode == PosixSocketWrapper::DSMODE_DUALSTACK ||
@@ -341,7 +375,7 @@ absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
   v4_sock = CreateAndPrepareListenerSocket(options, wild4);
   if (v4_sock.ok()) {
     assigned_port = v4_sock->port;
-    listener_sockets.Append(*v4_sock);
+    ListenerContainerAppendShardedSocket(listener_sockets, options, *v4_sock);
   }
   if (assigned_port > 0) {
     if (!v6_sock.ok()) {
@@ -374,6 +408,14 @@ CreateAndPrepareListenerSocket(const PosixTcpOptions& /*options*/,
       "CreateAndPrepareListenerSocket is not supported on this platform");
 }
 
+void ListenerContainerAppendShardedSocket(
+    ListenerSocketsContainer& /*listener_sockets*/,
+    const PosixTcpOptions& /*options*/,
+    const ListenerSocketsContainer::ListenerSocket& /*socket*/) {
+  grpc_core::Crash(
+      "ListenerContainerAppendShardedSocket is not supported on this platform");
+}
+
 absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
     ListenerSocketsContainer& /*listener_sockets*/,
     const PosixTcpOptions& /*options*/, int /*requested_port*/) {
@@ -64,6 +64,16 @@ CreateAndPrepareListenerSocket(
     const PosixTcpOptions& options,
     const grpc_event_engine::experimental::EventEngine::ResolvedAddress& addr);
 
+// Appends the passed socket to the passed ListenerSocketsContainer object. If
+// options.listener_shards is greater than 1, this also creates
+// options.listener_shards - 1 more sockets bound to the same address and port
+// with SO_REUSEPORT and appends them, so that the kernel spreads incoming
+// connections across the group. Failing to create a shard is not fatal: the
+// listener keeps working with the sockets created so far.
+void ListenerContainerAppendShardedSocket(
+    ListenerSocketsContainer& listener_sockets, const PosixTcpOptions& options,
+    const ListenerSocketsContainer::ListenerSocket& socket);
+
 // Instead of creating and adding a socket bound to specific address, this
 // function creates and adds a socket bound to the wildcard address on the
 // server. The newly created socket is configured according to the passed
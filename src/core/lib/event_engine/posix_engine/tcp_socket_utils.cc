@@ -43,6 +43,9 @@
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#ifdef GPR_LINUX
+#include <linux/filter.h>
+#endif  // GPR_LINUX
 #endif  //  GRPC_POSIX_SOCKET_UTILS_COMMON
 
 #include <atomic>
@@ -190,6 +193,12 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_rx_zerocopy_receive_bytes_threshold = AdjustValue(
+      PosixTcpOptions::kDefaultReceiveBytesThreshold, 0, INT_MAX,
+      config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD));
+  options.tcp_rx_zero_copy_enabled =
+      (AdjustValue(PosixTcpOptions::kZerocpRxEnabledDefault, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) != 0);
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -206,6 +215,17 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  options.listener_shards = AdjustValue(
+      PosixTcpOptions::kDefaultListenerShards, 1,
+      PosixTcpOptions::kMaxListenerShards,
+      config.GetInt(GRPC_ARG_TCP_LISTENER_SHARDS));
+  if (!options.allow_reuse_port) {
+    // Sharded listeners rely on SO_REUSEPORT to share the port.
+    options.listener_shards = 1;
+  }
+  options.listener_cpu_steering =
+      (AdjustValue(0, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_LISTENER_CPU_STEERING)) != 0);
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
@@ -407,6 +427,30 @@ absl::Status PosixSocketWrapper::SetSocketIpv6RecvPktInfoIfPossible() {
   return absl::OkStatus();
 }
 
+absl::Status PosixSocketWrapper::SetSocketBusyPollIfPossible(
+    int busy_poll_us) {
+#ifdef SO_BUSY_POLL
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us,
+                      sizeof(busy_poll_us))) {
+    return absl::Status(
+        absl::StatusCode::kInternal,
+        absl::StrCat("setsockopt(SO_BUSY_POLL): ", grpc_core::StrError(errno)));
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  int prefer_busy_poll = 1;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer_busy_poll,
+                      sizeof(prefer_busy_poll))) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("setsockopt(SO_PREFER_BUSY_POLL): ",
+                                     grpc_core::StrError(errno)));
+  }
+#endif
+#else
+  (void)busy_poll_us;
+#endif
+  return absl::OkStatus();
+}
+
 absl::Status PosixSocketWrapper::SetSocketSndBuf(int buffer_size_bytes) {
   return 0 == setsockopt(fd_, SOL_SOCKET, SO_SNDBUF, &buffer_size_bytes,
                          sizeof(buffer_size_bytes))
@@ -498,6 +542,35 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int reuse) {
 #endif
 }
 
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int num_sockets) {
+#if defined(GPR_LINUX) && defined(SO_ATTACH_REUSEPORT_CBPF)
+  CHECK_GT(num_sockets, 0);
+  // A = raw_smp_processor_id() % num_sockets; return A.
+  struct sock_filter code[] = {
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<uint32_t>(num_sockets)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  };
+  struct sock_fprog prog;
+  prog.len = sizeof(code) / sizeof(code[0]);
+  prog.filter = code;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog,
+                      sizeof(prog))) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("setsockopt(SO_ATTACH_REUSEPORT_CBPF): ",
+                                     grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+#else
+  (void)num_sockets;
+  return absl::Status(
+      absl::StatusCode::kInternal,
+      "SO_ATTACH_REUSEPORT_CBPF unavailable on compiling system");
+#endif
+}
+
 bool PosixSocketWrapper::IsSocketReusePortSupported() {
   static bool kSupportSoReusePort = []() -> bool {
     int s = socket(AF_INET, SOCK_STREAM, 0);
@@ -857,6 +930,11 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int /*reuse*/) {
   grpc_core::Crash("unimplemented");
 }
 
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int /*num_sockets*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketDscp(int /*dscp*/) {
   grpc_core::Crash("unimplemented");
 }
@@ -882,6 +960,11 @@ absl::Status PosixSocketWrapper::SetSocketIpv6RecvPktInfoIfPossible() {
   grpc_core::Crash("unimplemented");
 }
 
+absl::Status PosixSocketWrapper::SetSocketBusyPollIfPossible(
+    int /*busy_poll_us*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketSndBuf(int /*buffer_size_bytes*/) {
   grpc_core::Crash("unimplemented");
 }
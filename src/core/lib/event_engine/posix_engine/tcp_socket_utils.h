@@ -58,9 +58,13 @@ struct PosixTcpOptions {
   static constexpr int kMaxChunkSize = 32 * 1024 * 1024;
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;
+  static constexpr int kZerocpRxEnabledDefault = 0;
+  static constexpr int kDefaultReceiveBytesThreshold = 256 * 1024;
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
+  static constexpr int kDefaultListenerShards = 1;
+  static constexpr int kMaxListenerShards = 256;
   int tcp_read_chunk_size = kDefaultReadChunkSize;
   int tcp_min_read_chunk_size = kDefaultMinReadChunksize;
   int tcp_max_read_chunk_size = kDefaultMaxReadChunksize;
@@ -68,10 +72,14 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  int tcp_rx_zerocopy_receive_bytes_threshold = kDefaultReceiveBytesThreshold;
+  bool tcp_rx_zero_copy_enabled = kZerocpRxEnabledDefault;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  int listener_shards = kDefaultListenerShards;
+  bool listener_cpu_steering = false;
   int dscp = kDscpNotSet;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
@@ -139,10 +147,15 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_rx_zerocopy_receive_bytes_threshold =
+        other.tcp_rx_zerocopy_receive_bytes_threshold;
+    tcp_rx_zero_copy_enabled = other.tcp_rx_zero_copy_enabled;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    listener_shards = other.listener_shards;
+    listener_cpu_steering = other.listener_cpu_steering;
     dscp = other.dscp;
   }
 };
@@ -191,6 +204,11 @@ class PosixSocketWrapper {
   // Set SO_REUSEPORT
   absl::Status SetSocketReusePort(int reuse);
 
+  // Attach a classic BPF program to the SO_REUSEPORT group of this socket that
+  // selects the socket at index (receiving CPU % num_sockets) for each incoming
+  // connection.
+  absl::Status SetSocketReusePortCpuSteering(int num_sockets);
+
   // Set Differentiated Services Code Point (DSCP)
   absl::Status SetSocketDscp(int dscp);
 
@@ -210,6 +228,10 @@ class PosixSocketWrapper {
   // IPV6_RECVPKTINFO is not available, returns not OK status.
   absl::Status SetSocketIpv6RecvPktInfoIfPossible();
 
+  // Tries to set SO_BUSY_POLL to the given number of microseconds, and
+  // SO_PREFER_BUSY_POLL, where available on this platform.
+  absl::Status SetSocketBusyPollIfPossible(int busy_poll_us);
+
   // Tries to set the socket's send buffer to given size.
   absl::Status SetSocketSndBuf(int buffer_size_bytes);
 
@@ -30,6 +30,7 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/timing_wheel.h"
 
 static thread_local bool g_timer_thread;
 
@@ -85,9 +86,17 @@ void TimerManager::MainLoop() {
 bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 
 TimerManager::TimerManager(
-    std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool)
+    std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool,
+    TimerListKind timer_list_kind)
     : host_(this), thread_pool_(std::move(thread_pool)) {
-  timer_list_ = std::make_unique<TimerList>(&host_);
+  switch (timer_list_kind) {
+    case TimerListKind::kHeap:
+      timer_list_ = std::make_unique<TimerList>(&host_);
+      break;
+    case TimerListKind::kTimingWheel:
+      timer_list_ = std::make_unique<TimingWheelTimerList>(&host_);
+      break;
+  }
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
 }
@@ -40,6 +40,14 @@
 namespace grpc_event_engine {
 namespace experimental {
 
+// Which TimerListInterface implementation a TimerManager runs on.
+enum class TimerListKind {
+  // TimerList: sharded heaps, exact deadlines.
+  kHeap,
+  // TimingWheelTimerList: O(1) insert and cancel at millisecond granularity.
+  kTimingWheel,
+};
+
 // Timer Manager tries to keep only one thread waiting for the next timeout at
 // all times, and thus effectively preventing the thundering herd problem.
 // TODO(ctiller): consider unifying this thread pool and the one in
@@ -47,7 +55,8 @@ namespace experimental {
 class TimerManager final : public grpc_event_engine::experimental::Forkable {
  public:
   explicit TimerManager(
-      std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool);
+      std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool,
+      TimerListKind timer_list_kind = TimerListKind::kHeap);
   ~TimerManager() override;
 
   grpc_core::Timestamp Now() { return host_.Now(); }
@@ -99,7 +108,7 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
   // number of timer wakeups
   uint64_t wakeups_ ABSL_GUARDED_BY(mu_) = false;
   // actual timer implementation
-  std::unique_ptr<TimerList> timer_list_;
+  std::unique_ptr<TimerListInterface> timer_list_;
   std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool_;
   absl::optional<grpc_core::Notification> main_loop_exit_signal_;
 };
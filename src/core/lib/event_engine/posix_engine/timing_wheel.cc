@@ -0,0 +1,259 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timing_wheel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+constexpr int64_t kNever = std::numeric_limits<int64_t>::max();
+// Timers further out than this from the shard's clock go to the overflow list,
+// which is cascaded each time the clock crosses a multiple of it.
+constexpr int64_t kOverflowBoundary = int64_t{1} << 32;
+
+std::atomic<size_t> g_next_thread_shard{0};
+thread_local const size_t g_thread_shard =
+    g_next_thread_shard.fetch_add(1, std::memory_order_relaxed);
+
+void ListJoin(Timer* head, Timer* timer) {
+  timer->next = head;
+  timer->prev = head->prev;
+  timer->next->prev = timer->prev->next = timer;
+}
+
+void ListRemove(Timer* timer) {
+  timer->next->prev = timer->prev;
+  timer->prev->next = timer->next;
+}
+
+bool ListEmpty(const Timer* head) { return head->next == head; }
+
+}  // namespace
+
+TimingWheelTimerList::Shard::Shard() {
+  for (auto& level : slots) {
+    for (Timer& head : level) head.next = head.prev = &head;
+  }
+  overflow.next = overflow.prev = &overflow;
+}
+
+void TimingWheelTimerList::Shard::Place(Timer* timer) {
+  const int64_t tick = std::max(timer->deadline, now + 1);
+  // The level is the highest slot digit in which tick and now differ; since
+  // tick > now, its digit there is greater than now's, so the slot is reached
+  // before the wheel wraps around.
+  const uint64_t diff = static_cast<uint64_t>(tick ^ now);
+  int level = 0;
+  while (level < kLevels && (diff >> (kSlotBits * (level + 1))) != 0) {
+    ++level;
+  }
+  Timer* head;
+  if (level == kLevels) {
+    level = kOverflowLevel;
+    head = &overflow;
+  } else {
+    head = &slots[level][(tick >> (kSlotBits * level)) & (kSlots - 1)];
+  }
+  timer->wheel_level = level;
+  ListJoin(head, timer);
+  ++count[level];
+  ++total;
+}
+
+void TimingWheelTimerList::Shard::Cascade(
+    int level, Timer* head,
+    std::vector<experimental::EventEngine::Closure*>* out) {
+  if (ListEmpty(head)) return;
+  // Detach the list first: overflow timers may be placed back into it.
+  Timer detached;
+  detached.next = head->next;
+  detached.prev = head->prev;
+  detached.next->prev = detached.prev->next = &detached;
+  head->next = head->prev = head;
+  while (!ListEmpty(&detached)) {
+    Timer* timer = detached.next;
+    ListRemove(timer);
+    --count[level];
+    --total;
+    // A timer due exactly on the boundary being crossed expires now rather
+    // than a tick late.
+    if (timer->deadline <= now) {
+      timer->pending = false;
+      out->push_back(timer->closure);
+    } else {
+      Place(timer);
+    }
+  }
+}
+
+void TimingWheelTimerList::Shard::Advance(
+    int64_t target, std::vector<experimental::EventEngine::Closure*>* out) {
+  while (now < target) {
+    // Skip the ticks at which nothing is due or cascaded.
+    const int64_t next_event = NextEvent();
+    if (next_event > target) {
+      now = target;
+      return;
+    }
+    now = next_event;
+    if (now % kOverflowBoundary == 0) Cascade(kOverflowLevel, &overflow, out);
+    for (int level = kLevels - 1; level > 0; --level) {
+      const int shift = kSlotBits * level;
+      if ((now & ((int64_t{1} << shift) - 1)) != 0) continue;
+      Cascade(level, &slots[level][(now >> shift) & (kSlots - 1)], out);
+    }
+    Timer* head = &slots[0][now & (kSlots - 1)];
+    while (!ListEmpty(head)) {
+      Timer* timer = head->next;
+      ListRemove(timer);
+      timer->pending = false;
+      --count[0];
+      --total;
+      out->push_back(timer->closure);
+    }
+  }
+}
+
+int64_t TimingWheelTimerList::Shard::NextEvent() {
+  if (total == 0) return kNever;
+  // Every event on a level comes before any event on the levels above it.
+  for (int level = 0; level < kLevels; ++level) {
+    if (count[level] == 0) continue;
+    const int shift = kSlotBits * level;
+    const int64_t base = (now >> (shift + kSlotBits)) << (shift + kSlotBits);
+    for (size_t slot = ((now >> shift) & (kSlots - 1)) + 1; slot < kSlots;
+         ++slot) {
+      if (!ListEmpty(&slots[level][slot])) {
+        return base | (static_cast<int64_t>(slot) << shift);
+      }
+    }
+  }
+  return (now / kOverflowBoundary + 1) * kOverflowBoundary;
+}
+
+TimingWheelTimerList::TimingWheelTimerList(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(host_->Now().milliseconds_after_process_epoch()),
+      inserted_min_(kNever),
+      shards_(new Shard[num_shards_]) {
+  for (size_t i = 0; i < num_shards_; i++) {
+    grpc_core::MutexLock lock(&shards_[i].mu);
+    shards_[i].now = min_timer_.load(std::memory_order_relaxed);
+  }
+}
+
+TimingWheelTimerList::Shard* TimingWheelTimerList::ShardForThisThread() {
+  return &shards_[g_thread_shard % num_shards_];
+}
+
+bool TimingWheelTimerList::LowerTo(std::atomic<int64_t>* value,
+                                   int64_t deadline) {
+  int64_t current = value->load(std::memory_order_relaxed);
+  while (deadline < current) {
+    if (value->compare_exchange_weak(current, deadline,
+                                     std::memory_order_acq_rel)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void TimingWheelTimerList::TimerInit(
+    Timer* timer, grpc_core::Timestamp deadline,
+    experimental::EventEngine::Closure* closure) {
+  Shard* shard = ShardForThisThread();
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+  timer->wheel_shard = static_cast<uint16_t>(shard - shards_.get());
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    shard->Place(timer);
+  }
+
+  // Record the deadline for any TimerCheck that is scanning concurrently
+  // before publishing it, so that the scan's result cannot hide it.
+  LowerTo(&inserted_min_, timer->deadline);
+  if (LowerTo(&min_timer_, timer->deadline)) host_->Kick();
+}
+
+bool TimingWheelTimerList::TimerCancel(Timer* timer) {
+  Shard* shard = &shards_[timer->wheel_shard];
+  grpc_core::MutexLock lock(&shard->mu);
+  if (!timer->pending) return false;
+  timer->pending = false;
+  ListRemove(timer);
+  --shard->count[timer->wheel_level];
+  --shard->total;
+  return true;
+}
+
+absl::optional<std::vector<experimental::EventEngine::Closure*>>
+TimingWheelTimerList::TimerCheck(grpc_core::Timestamp* next) {
+  const int64_t now = host_->Now().milliseconds_after_process_epoch();
+  std::vector<experimental::EventEngine::Closure*> done;
+
+  int64_t min_timer = min_timer_.load(std::memory_order_relaxed);
+  if (now < min_timer) {
+    if (next != nullptr) {
+      *next = std::min(
+          *next,
+          grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(min_timer));
+    }
+    return done;
+  }
+
+  if (!checker_mu_.TryLock()) return absl::nullopt;
+  inserted_min_.store(kNever, std::memory_order_seq_cst);
+  int64_t next_event = kNever;
+  for (size_t i = 0; i < num_shards_; i++) {
+    Shard& shard = shards_[i];
+    grpc_core::MutexLock lock(&shard.mu);
+    shard.Advance(now, &done);
+    next_event = std::min(next_event, shard.NextEvent());
+  }
+  min_timer_.store(next_event, std::memory_order_seq_cst);
+  LowerTo(&min_timer_, inserted_min_.load(std::memory_order_seq_cst));
+  min_timer = min_timer_.load(std::memory_order_relaxed);
+  checker_mu_.Unlock();
+
+  if (next != nullptr) {
+    *next = std::min(
+        *next,
+        grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(min_timer));
+  }
+  return done;
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
@@ -0,0 +1,116 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMING_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMING_WHEEL_H
+
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// A hierarchical timing wheel with one millisecond ticks.
+//
+// Each shard holds kLevels wheels of kSlots slots; level L slot S holds the
+// timers whose deadline agrees with the shard's current tick above bit
+// 8 * (L + 1) and has S in bits [8 * L, 8 * (L + 1)). Timers further out than
+// the top level can address wait in an overflow list. As the shard's clock
+// advances, each time it crosses a level L boundary the matching level L slot
+// is cascaded down into finer levels, and the level 0 slot for the new tick
+// expires. Insert and cancel are O(1) list operations under the shard lock.
+//
+// Timers are placed in the shard belonging to the inserting thread rather
+// than hashed by address, so that a thread arming and cancelling its own
+// timers does not contend with other threads.
+class TimingWheelTimerList : public TimerListInterface {
+ public:
+  explicit TimingWheelTimerList(TimerListHost* host);
+
+  TimingWheelTimerList(const TimingWheelTimerList&) = delete;
+  TimingWheelTimerList& operator=(const TimingWheelTimerList&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+  absl::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr int kSlotBits = 8;
+  static constexpr size_t kSlots = 1 << kSlotBits;
+  static constexpr int kLevels = 4;
+  // Timer::wheel_level of timers waiting in the overflow list.
+  static constexpr int kOverflowLevel = kLevels;
+
+  struct Shard {
+    Shard();
+
+    // Adds timer to the slot matching its deadline relative to now.
+    void Place(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Re-places every timer in the given list, expiring the ones due now.
+    void Cascade(int level, Timer* head,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Moves now forward to target, appending expired closures to out.
+    void Advance(int64_t target,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // The earliest tick at which Advance may have work to do.
+    int64_t NextEvent() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // The last tick processed. Every pending timer has a deadline after it.
+    int64_t now ABSL_GUARDED_BY(mu);
+    size_t count[kLevels + 1] ABSL_GUARDED_BY(mu) = {};
+    size_t total ABSL_GUARDED_BY(mu) = 0;
+    Timer slots[kLevels][kSlots] ABSL_GUARDED_BY(mu);
+    Timer overflow ABSL_GUARDED_BY(mu);
+  };
+
+  Shard* ShardForThisThread();
+  // Lowers *value to deadline, returning true if it was later.
+  static bool LowerTo(std::atomic<int64_t>* value, int64_t deadline);
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  // The deadline of the next timer due across all shards, or earlier.
+  std::atomic<int64_t> min_timer_;
+  // The earliest deadline inserted since the last TimerCheck started
+  // scanning, so that the scan cannot overwrite min_timer_ with a later value
+  // than a timer it missed.
+  std::atomic<int64_t> inserted_min_;
+  // Allow only one TimerCheck to scan at once (used as a TryLock).
+  grpc_core::Mutex checker_mu_;
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMING_WHEEL_H
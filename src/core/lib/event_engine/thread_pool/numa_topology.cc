@@ -0,0 +1,160 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif  // _GNU_SOURCE
+
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
+
+#include <stdio.h>
+
+#include <string>
+#include <utility>
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/strip.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_LINUX
+#include <sched.h>
+#endif
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// Reads the first line of a small sysfs file.
+absl::optional<std::string> ReadLine(const std::string& path) {
+  FILE* fp = fopen(path.c_str(), "r");
+  if (fp == nullptr) return absl::nullopt;
+  std::string line;
+  char buf[256];
+  while (fgets(buf, sizeof(buf), fp) != nullptr) {
+    line += buf;
+    if (!line.empty() && line.back() == '\n') break;
+  }
+  fclose(fp);
+  return std::string(absl::StripAsciiWhitespace(line));
+}
+
+}  // namespace
+
+NumaTopology::NumaTopology(std::vector<std::vector<int>> node_cpus) {
+  for (auto& cpus : node_cpus) {
+    if (!cpus.empty()) node_cpus_.push_back(std::move(cpus));
+  }
+  if (node_cpus_.empty()) {
+    node_cpus_.emplace_back();
+    for (unsigned i = 0; i < gpr_cpu_num_cores(); i++) {
+      node_cpus_.back().push_back(static_cast<int>(i));
+    }
+  }
+  for (size_t node = 0; node < node_cpus_.size(); node++) {
+    for (int cpu : node_cpus_[node]) {
+      if (static_cast<size_t>(cpu) >= cpu_nodes_.size()) {
+        cpu_nodes_.resize(cpu + 1, kNoNode);
+      }
+      // The first node listing a CPU keeps it.
+      if (cpu_nodes_[cpu] == kNoNode) cpu_nodes_[cpu] = node;
+    }
+  }
+}
+
+NumaTopology NumaTopology::Flat() { return NumaTopology({}); }
+
+NumaTopology NumaTopology::Discover(absl::string_view sysfs_node_dir) {
+  auto online = ReadLine(absl::StrCat(sysfs_node_dir, "/online"));
+  if (!online.has_value()) return Flat();
+  auto nodes = ParseCpuList(*online);
+  if (!nodes.has_value()) return Flat();
+  std::vector<std::vector<int>> node_cpus;
+  for (int node : *nodes) {
+    auto cpulist =
+        ReadLine(absl::StrCat(sysfs_node_dir, "/node", node, "/cpulist"));
+    if (!cpulist.has_value()) return Flat();
+    auto cpus = ParseCpuList(*cpulist);
+    if (!cpus.has_value()) return Flat();
+    node_cpus.push_back(std::move(*cpus));
+  }
+  return NumaTopology(std::move(node_cpus));
+}
+
+const NumaTopology& NumaTopology::Host() {
+  static const NumaTopology* const topology = new NumaTopology(Discover());
+  return *topology;
+}
+
+NumaTopology NumaTopology::Synthetic(size_t num_nodes) {
+  const size_t num_cpus = gpr_cpu_num_cores();
+  if (num_nodes == 0) num_nodes = 1;
+  std::vector<std::vector<int>> node_cpus(num_nodes);
+  for (size_t cpu = 0; cpu < num_cpus; cpu++) {
+    node_cpus[cpu * num_nodes / num_cpus].push_back(static_cast<int>(cpu));
+  }
+  return NumaTopology(std::move(node_cpus));
+}
+
+absl::optional<size_t> NumaTopology::NodeForCpu(int cpu) const {
+  if (cpu < 0 || static_cast<size_t>(cpu) >= cpu_nodes_.size() ||
+      cpu_nodes_[cpu] == kNoNode) {
+    return absl::nullopt;
+  }
+  return cpu_nodes_[cpu];
+}
+
+absl::optional<std::vector<int>> ParseCpuList(absl::string_view list) {
+  std::vector<int> cpus;
+  list = absl::StripAsciiWhitespace(list);
+  if (list.empty()) return cpus;
+  for (absl::string_view range : absl::StrSplit(list, ',')) {
+    const size_t dash = range.find('-');
+    int first;
+    int last;
+    if (!absl::SimpleAtoi(range.substr(0, dash), &first) || first < 0) {
+      return absl::nullopt;
+    }
+    if (dash == absl::string_view::npos) {
+      last = first;
+    } else if (!absl::SimpleAtoi(range.substr(dash + 1), &last) ||
+               last < first) {
+      return absl::nullopt;
+    }
+    for (int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+bool PinCurrentThreadToCpus(const std::vector<int>& cpus) {
+#ifdef GPR_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+  }
+  if (CPU_COUNT(&set) == 0) return false;
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  (void)cpus;
+  return false;
+#endif
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
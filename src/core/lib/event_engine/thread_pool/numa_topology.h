@@ -0,0 +1,72 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_NUMA_TOPOLOGY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_NUMA_TOPOLOGY_H
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// The CPUs belonging to each NUMA node of the host.
+class NumaTopology {
+ public:
+  // Each entry holds the CPUs of one node. Empty nodes are dropped, and an
+  // empty list yields a single node holding every CPU.
+  explicit NumaTopology(std::vector<std::vector<int>> node_cpus);
+
+  // A single node holding every CPU.
+  static NumaTopology Flat();
+  // Reads the node layout from sysfs_node_dir (the "online" node list and
+  // each node's "cpulist"). Returns Flat() if the layout cannot be read, as
+  // on non-Linux hosts.
+  static NumaTopology Discover(
+      absl::string_view sysfs_node_dir = "/sys/devices/system/node");
+  // Discover(), read once per process.
+  static const NumaTopology& Host();
+  // Splits every CPU into num_nodes nodes of contiguous CPU ids, to exercise
+  // NUMA aware scheduling on hosts with a single node.
+  static NumaTopology Synthetic(size_t num_nodes);
+
+  size_t num_nodes() const { return node_cpus_.size(); }
+  const std::vector<int>& cpus(size_t node) const { return node_cpus_[node]; }
+  // The node holding cpu, or nullopt if no node lists it.
+  absl::optional<size_t> NodeForCpu(int cpu) const;
+
+ private:
+  std::vector<std::vector<int>> node_cpus_;
+  // Indexed by CPU id; kNoNode for CPUs that no node lists.
+  static constexpr size_t kNoNode = static_cast<size_t>(-1);
+  std::vector<size_t> cpu_nodes_;
+};
+
+// Parses a sysfs CPU or node list such as "0-3,8,10-11". Returns nullopt if
+// the list is malformed.
+absl::optional<std::vector<int>> ParseCpuList(absl::string_view list);
+
+// Restricts the calling thread to the given CPUs. Returns false if that is
+// not supported on this platform or the CPUs were rejected.
+bool PinCurrentThreadToCpus(const std::vector<int>& cpus);
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_NUMA_TOPOLOGY_H
@@ -46,6 +46,7 @@
 #include "src/core/lib/gprpp/examine_stack.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/gprpp/time.h"
+#include "src/core/util/latent_see.h"
 
 #ifdef GPR_POSIX_SYNC
 #include <csignal>
@@ -102,6 +103,16 @@
 // enable advanced debugging. When the pool takes too long to quiesce, a
 // backtrace will be printed for every running thread, and the process will
 // abort.
+//
+// ## NUMA
+//
+// Worker threads are assigned to NUMA nodes round robin as they start. Each
+// node has its own global queue, which takes closures run from outside the
+// pool by threads on that node's CPUs, and its own theft registry. An idle
+// worker first tries its node's global queue and registry, and only then
+// those of the other nodes, so work crosses nodes only when a node runs dry.
+// Set GRPC_THREAD_POOL_NUMA_PIN=anything to also restrict each worker to
+// its node's CPUs. On hosts with a single node this is the flat pool.
 
 namespace grpc_event_engine {
 namespace experimental {
@@ -151,6 +162,9 @@ constexpr bool g_log_verbose_failures = false;
 constexpr int kDumpStackSignal = -1;
 #endif
 
+const bool g_pin_threads_to_nodes =
+    grpc_core::GetEnv("GRPC_THREAD_POOL_NUMA_PIN").has_value();
+
 std::atomic<size_t> g_reported_dump_count{0};
 
 void DumpSignalHandler(int /* sig */) {
@@ -172,7 +186,14 @@ thread_local WorkQueue* g_local_queue = nullptr;
 // -------- WorkStealingThreadPool --------
 
 WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads)
-    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads)} {
+    : WorkStealingThreadPool(reserve_threads, NumaTopology::Host(),
+                             g_pin_threads_to_nodes) {}
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads,
+                                               NumaTopology topology,
+                                               bool pin_threads_to_nodes)
+    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(
+          reserve_threads, std::move(topology), pin_threads_to_nodes)} {
   if (g_log_verbose_failures) {
     GRPC_TRACE_LOG(event_engine, INFO)
         << "WorkStealingThreadPool verbose failures are enabled";
@@ -216,6 +237,11 @@ EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
   return nullptr;
 }
 
+// -------- WorkStealingThreadPool::Node --------
+
+WorkStealingThreadPool::Node::Node(void* owner, std::vector<int> cpus)
+    : queue(owner), cpus(std::move(cpus)) {}
+
 void WorkStealingThreadPool::PrepareFork() { pool_->PrepareFork(); }
 
 void WorkStealingThreadPool::PostforkParent() { pool_->Postfork(); }
@@ -225,8 +251,14 @@ void WorkStealingThreadPool::PostforkChild() { pool_->Postfork(); }
 // -------- WorkStealingThreadPool::WorkStealingThreadPoolImpl --------
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
-    size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    size_t reserve_threads, NumaTopology topology, bool pin_threads_to_nodes)
+    : reserve_threads_(reserve_threads),
+      topology_(std::move(topology)),
+      pin_threads_to_nodes_(pin_threads_to_nodes) {
+  for (size_t i = 0; i < topology_.num_nodes(); i++) {
+    nodes_.push_back(std::make_unique<Node>(this, topology_.cpus(i)));
+  }
+}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -242,7 +274,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
   if (g_local_queue != nullptr && g_local_queue->owner() == this) {
     g_local_queue->Add(closure);
   } else {
-    queue_.Add(closure);
+    NodeForCurrentThread()->queue.Add(closure);
   }
   // Signal a worker in any case, even if work was added to a local queue. This
   // improves performance on 32-core streaming benchmarks with small payloads.
@@ -250,6 +282,8 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
 }
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
+  const size_t node =
+      next_thread_node_.fetch_add(1, std::memory_order_relaxed) % nodes_.size();
   last_started_thread_.store(
       grpc_core::Timestamp::Now().milliseconds_after_process_epoch(),
       std::memory_order_relaxed);
@@ -260,7 +294,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
         worker->ThreadBody();
         delete worker;
       },
-      new ThreadState(shared_from_this()), nullptr,
+      new ThreadState(shared_from_this(), node), nullptr,
       grpc_core::Thread::Options().set_tracked(false).set_joinable(false))
       .Start();
 }
@@ -280,12 +314,30 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
   if (!threads_were_shut_down.ok() && g_log_verbose_failures) {
     DumpStacksAndCrash();
   }
-  CHECK(queue_.Empty());
+  CHECK(GlobalQueuesEmpty());
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
 }
 
+bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::GlobalQueuesEmpty() {
+  for (const auto& node : nodes_) {
+    if (!node->queue.Empty()) return false;
+  }
+  return true;
+}
+
+WorkStealingThreadPool::Node*
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::NodeForCurrentThread() {
+  if (nodes_.size() == 1) return nodes_[0].get();
+  auto node = topology_.NodeForCpu(static_cast<int>(gpr_cpu_current_cpu()));
+  if (!node.has_value()) {
+    node = next_run_node_.fetch_add(1, std::memory_order_relaxed) %
+           nodes_.size();
+  }
+  return nodes_[*node].get();
+}
+
 bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::SetThrottled(
     bool throttled) {
   return throttled_.exchange(throttled, std::memory_order_relaxed);
@@ -435,7 +487,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   const auto living_thread_count = pool_->living_thread_count()->count();
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
-    if (!pool_->queue_.Empty()) {
+    if (!pool_->GlobalQueuesEmpty()) {
       pool_->work_signal()->Signal();
       backoff_.Reset();
     }
@@ -467,7 +519,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
 // -------- WorkStealingThreadPool::ThreadState --------
 
 WorkStealingThreadPool::ThreadState::ThreadState(
-    std::shared_ptr<WorkStealingThreadPoolImpl> pool)
+    std::shared_ptr<WorkStealingThreadPoolImpl> pool, size_t node)
     : pool_(std::move(pool)),
       auto_thread_counter_(
           pool_->living_thread_count()->MakeAutoThreadCounter()),
@@ -475,7 +527,8 @@ WorkStealingThreadPool::ThreadState::ThreadState(
                    .set_initial_backoff(kWorkerThreadMinSleepBetweenChecks)
                    .set_max_backoff(kWorkerThreadMaxSleepBetweenChecks)
                    .set_multiplier(1.3)),
-      busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
+      busy_count_idx_(pool_->busy_thread_count()->NextIndex()),
+      node_(node) {}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
   if (g_log_verbose_failures) {
@@ -486,8 +539,13 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
+  Node* node = pool_->node(node_);
+  if (pool_->pin_threads_to_nodes() && !PinCurrentThreadToCpus(node->cpus)) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "WorkStealingThreadPool could not pin a thread to node " << node_;
+  }
   g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  node->theft_registry.Enroll(g_local_queue);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -499,14 +557,14 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     while (!g_local_queue->Empty()) {
       closure = g_local_queue->PopMostRecent();
       if (closure != nullptr) {
-        pool_->queue()->Add(closure);
+        node->queue.Add(closure);
       }
     }
   } else if (pool_->IsShutdown()) {
     FinishDraining();
   }
   CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  node->theft_registry.Unenroll(g_local_queue);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -526,29 +584,30 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   if (closure != nullptr) {
     auto busy =
         pool_->busy_thread_count()->MakeAutoThreadCounter(busy_count_idx_);
+    GRPC_LATENT_SEE_PARENT_SCOPE("EventEngine closure");
     closure->Run();
     return true;
   }
   // Thread shutdown exit condition (ignoring fork). All must be true:
   // * shutdown was called
   // * the local queue is empty
-  // * the global queue is empty
-  // * the steal pool returns nullptr
+  // * every node's global queue is empty
+  // * every node's steal pool returns nullptr
   bool should_run_again = false;
   auto start_time = std::chrono::steady_clock::now();
   // Wait until work is available or until shut down.
   while (!pool_->IsForking()) {
-    // Pull from the global queue next
+    // Pull from the global queue next, then try stealing; this node first,
+    // then the remote ones.
     // TODO(hork): consider an empty check for performance wins. Depends on the
     // queue implementation, the BasicWorkQueue takes two locks when you do an
     // empty check then pop.
-    closure = pool_->queue()->PopMostRecent();
-    if (closure != nullptr) {
-      should_run_again = true;
-      break;
-    };
-    // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    const size_t num_nodes = pool_->num_nodes();
+    for (size_t i = 0; i < num_nodes && closure == nullptr; i++) {
+      Node* node = pool_->node((node_ + i) % num_nodes);
+      closure = node->queue.PopMostRecent();
+      if (closure == nullptr) closure = node->theft_registry.StealOne();
+    }
     if (closure != nullptr) {
       should_run_again = true;
       break;
@@ -575,6 +634,7 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   if (closure != nullptr) {
     auto busy =
         pool_->busy_thread_count()->MakeAutoThreadCounter(busy_count_idx_);
+    GRPC_LATENT_SEE_PARENT_SCOPE("EventEngine closure");
     closure->Run();
   }
   backoff_.Reset();
@@ -591,18 +651,25 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
     if (!g_local_queue->Empty()) {
       auto* closure = g_local_queue->PopMostRecent();
       if (closure != nullptr) {
+        GRPC_LATENT_SEE_PARENT_SCOPE("EventEngine closure");
         closure->Run();
       }
       continue;
     }
-    if (!pool_->queue()->Empty()) {
-      auto* closure = pool_->queue()->PopMostRecent();
+    // Nodes may have no threads of their own left, so drain them all.
+    bool ran = false;
+    for (size_t i = 0; i < pool_->num_nodes(); i++) {
+      Node* node = pool_->node((node_ + i) % pool_->num_nodes());
+      if (node->queue.Empty()) continue;
+      auto* closure = node->queue.PopMostRecent();
       if (closure != nullptr) {
+        GRPC_LATENT_SEE_PARENT_SCOPE("EventEngine closure");
         closure->Run();
       }
-      continue;
+      ran = true;
+      break;
     }
-    break;
+    if (!ran) break;
   }
 }
 
@@ -23,6 +23,7 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
@@ -33,6 +34,7 @@
 #include <grpc/support/thd_id.h>
 
 #include "src/core/lib/backoff/backoff.h"
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
@@ -44,9 +46,17 @@
 namespace grpc_event_engine {
 namespace experimental {
 
+// Worker threads are spread across the NUMA nodes of the host. Each node has
+// its own global queue and theft registry, and an idle thread looks for work
+// on its own node before it looks at remote ones, so that closures queued by
+// threads on a node tend to run there.
 class WorkStealingThreadPool final : public ThreadPool {
  public:
+  // Uses the host's NUMA topology. Threads are pinned to their node if the
+  // GRPC_THREAD_POOL_NUMA_PIN environment variable is set.
   explicit WorkStealingThreadPool(size_t reserve_threads);
+  WorkStealingThreadPool(size_t reserve_threads, NumaTopology topology,
+                         bool pin_threads_to_nodes);
   // Asserts Quiesce was called.
   ~WorkStealingThreadPool() override;
   // Shut down the pool, and wait for all threads to exit.
@@ -97,6 +107,15 @@ class WorkStealingThreadPool final : public ThreadPool {
     absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
   };
 
+  // The work shared by the threads of one NUMA node.
+  struct Node {
+    Node(void* owner, std::vector<int> cpus);
+
+    BasicWorkQueue queue;
+    TheftRegistry theft_registry;
+    const std::vector<int> cpus;
+  };
+
   // An implementation of the ThreadPool
   // This object is held as a shared_ptr between the owning ThreadPool and each
   // worker thread. This design allows a ThreadPool worker thread to be the last
@@ -104,11 +123,12 @@ class WorkStealingThreadPool final : public ThreadPool {
   class WorkStealingThreadPoolImpl
       : public std::enable_shared_from_this<WorkStealingThreadPoolImpl> {
    public:
-    explicit WorkStealingThreadPoolImpl(size_t reserve_threads);
+    WorkStealingThreadPoolImpl(size_t reserve_threads, NumaTopology topology,
+                               bool pin_threads_to_nodes);
     // Start all threads.
     void Start();
     // Add a closure to a work queue, preferably a thread-local queue if
-    // available, otherwise the global queue.
+    // available, otherwise the global queue of the caller's node.
     void Run(EventEngine::Closure* closure);
     // Start a new thread.
     // The reason argument determines whether thread creation is rate-limited;
@@ -142,8 +162,11 @@ class WorkStealingThreadPool final : public ThreadPool {
     size_t reserve_threads() { return reserve_threads_; }
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
-    TheftRegistry* theft_registry() { return &theft_registry_; }
-    WorkQueue* queue() { return &queue_; }
+    size_t num_nodes() const { return nodes_.size(); }
+    Node* node(size_t index) { return nodes_[index].get(); }
+    bool pin_threads_to_nodes() const { return pin_threads_to_nodes_; }
+    // Whether every node's global queue is empty.
+    bool GlobalQueuesEmpty();
     WorkSignal* work_signal() { return &work_signal_; }
 
    private:
@@ -172,12 +195,19 @@ class WorkStealingThreadPool final : public ThreadPool {
     };
 
     void DumpStacksAndCrash();
+    // The node whose global queue takes closures run from outside the pool.
+    Node* NodeForCurrentThread();
 
     const size_t reserve_threads_;
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
-    TheftRegistry theft_registry_;
-    BasicWorkQueue queue_;
+    const NumaTopology topology_;
+    const bool pin_threads_to_nodes_;
+    std::vector<std::unique_ptr<Node>> nodes_;
+    // Round robin counters for placing new threads, and closures from threads
+    // whose CPU is unknown, on nodes.
+    std::atomic<size_t> next_thread_node_{0};
+    std::atomic<size_t> next_run_node_{0};
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -199,7 +229,8 @@ class WorkStealingThreadPool final : public ThreadPool {
 
   class ThreadState {
    public:
-    explicit ThreadState(std::shared_ptr<WorkStealingThreadPoolImpl> pool);
+    ThreadState(std::shared_ptr<WorkStealingThreadPoolImpl> pool,
+                size_t node);
     void ThreadBody();
     void SleepIfRunning();
     bool Step();
@@ -217,6 +248,8 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    // The NUMA node this thread belongs to.
+    const size_t node_;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
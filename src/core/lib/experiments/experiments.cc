@@ -42,6 +42,10 @@ const char* const additional_constraints_event_engine_listener = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_hpack_multisym_huffman_decoder =
+    "Decode huffman coded HPACK strings with the table driven decoder, which "
+    "emits several symbols per lookup, instead of the generated one.";
+const char* const additional_constraints_hpack_multisym_huffman_decoder = "{}";
 const char* const description_max_pings_wo_data_throttle =
     "Experiment to throttle pings to a period of 1 min when "
     "GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA limit has reached (instead of "
@@ -65,6 +69,11 @@ const char* const additional_constraints_schedule_cancellation_over_write =
     "{}";
 const char* const description_server_privacy = "If set, server privacy";
 const char* const additional_constraints_server_privacy = "{}";
+const char* const description_stream_compression =
+    "Let a client and server that both set grpc.compression_enable_streaming "
+    "negotiate, with the grpc-stream-compression header, compressing the "
+    "server's messages on a call as one stream.";
+const char* const additional_constraints_stream_compression = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -109,6 +118,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_event_engine_listener, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"hpack_multisym_huffman_decoder",
+     description_hpack_multisym_huffman_decoder,
+     additional_constraints_hpack_multisym_huffman_decoder, nullptr, 0, false,
+     true},
     {"max_pings_wo_data_throttle", description_max_pings_wo_data_throttle,
      additional_constraints_max_pings_wo_data_throttle, nullptr, 0, false,
      true},
@@ -128,6 +141,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true},
     {"server_privacy", description_server_privacy,
      additional_constraints_server_privacy, nullptr, 0, false, false},
+    {"stream_compression", description_stream_compression,
+     additional_constraints_stream_compression, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
@@ -170,6 +185,10 @@ const char* const additional_constraints_event_engine_listener = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_hpack_multisym_huffman_decoder =
+    "Decode huffman coded HPACK strings with the table driven decoder, which "
+    "emits several symbols per lookup, instead of the generated one.";
+const char* const additional_constraints_hpack_multisym_huffman_decoder = "{}";
 const char* const description_max_pings_wo_data_throttle =
     "Experiment to throttle pings to a period of 1 min when "
     "GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA limit has reached (instead of "
@@ -193,6 +212,11 @@ const char* const additional_constraints_schedule_cancellation_over_write =
     "{}";
 const char* const description_server_privacy = "If set, server privacy";
 const char* const additional_constraints_server_privacy = "{}";
+const char* const description_stream_compression =
+    "Let a client and server that both set grpc.compression_enable_streaming "
+    "negotiate, with the grpc-stream-compression header, compressing the "
+    "server's messages on a call as one stream.";
+const char* const additional_constraints_stream_compression = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -237,6 +261,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_event_engine_listener, nullptr, 0, true, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"hpack_multisym_huffman_decoder",
+     description_hpack_multisym_huffman_decoder,
+     additional_constraints_hpack_multisym_huffman_decoder, nullptr, 0, false,
+     true},
     {"max_pings_wo_data_throttle", description_max_pings_wo_data_throttle,
      additional_constraints_max_pings_wo_data_throttle, nullptr, 0, false,
      true},
@@ -256,6 +284,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true},
     {"server_privacy", description_server_privacy,
      additional_constraints_server_privacy, nullptr, 0, false, false},
+    {"stream_compression", description_stream_compression,
+     additional_constraints_stream_compression, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
@@ -298,6 +328,10 @@ const char* const additional_constraints_event_engine_listener = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
+const char* const description_hpack_multisym_huffman_decoder =
+    "Decode huffman coded HPACK strings with the table driven decoder, which "
+    "emits several symbols per lookup, instead of the generated one.";
+const char* const additional_constraints_hpack_multisym_huffman_decoder = "{}";
 const char* const description_max_pings_wo_data_throttle =
     "Experiment to throttle pings to a period of 1 min when "
     "GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA limit has reached (instead of "
@@ -321,6 +355,11 @@ const char* const additional_constraints_schedule_cancellation_over_write =
     "{}";
 const char* const description_server_privacy = "If set, server privacy";
 const char* const additional_constraints_server_privacy = "{}";
+const char* const description_stream_compression =
+    "Let a client and server that both set grpc.compression_enable_streaming "
+    "negotiate, with the grpc-stream-compression header, compressing the "
+    "server's messages on a call as one stream.";
+const char* const additional_constraints_stream_compression = "{}";
 const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
@@ -365,6 +404,10 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_event_engine_listener, nullptr, 0, true, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
+    {"hpack_multisym_huffman_decoder",
+     description_hpack_multisym_huffman_decoder,
+     additional_constraints_hpack_multisym_huffman_decoder, nullptr, 0, false,
+     true},
     {"max_pings_wo_data_throttle", description_max_pings_wo_data_throttle,
      additional_constraints_max_pings_wo_data_throttle, nullptr, 0, false,
      true},
@@ -384,6 +427,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      true},
     {"server_privacy", description_server_privacy,
      additional_constraints_server_privacy, nullptr, 0, false, false},
+    {"stream_compression", description_stream_compression,
+     additional_constraints_stream_compression, nullptr, 0, false, true},
     {"tcp_frame_size_tuning", description_tcp_frame_size_tuning,
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
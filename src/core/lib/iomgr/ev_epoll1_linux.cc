@@ -35,6 +35,7 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -47,6 +48,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/cpu.h>
 
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/gprpp/strerror.h"
 #include "src/core/lib/iomgr/block_annotate.h"
@@ -60,6 +62,8 @@
 #include "src/core/util/string.h"
 #include "src/core/util/useful.h"
 
+using grpc_event_engine::experimental::BusyPollBudget;
+
 static grpc_wakeup_fd global_wakeup_fd;
 static bool g_is_shutdown = true;
 
@@ -479,6 +483,9 @@ static gpr_atm g_active_poller;
 
 static pollset_neighborhood* g_neighborhoods;
 static size_t g_num_neighborhoods;
+// Spins on non-blocking epoll_waits before blocking, if enabled by
+// GRPC_EPOLL_BUSY_POLL_US.
+static BusyPollBudget* g_busy_poll;
 
 // Return true if first in list
 static bool worker_insert(grpc_pollset* pollset, grpc_pollset_worker* worker) {
@@ -540,6 +547,7 @@ static grpc_error_handle pollset_global_init(void) {
   for (size_t i = 0; i < g_num_neighborhoods; i++) {
     gpr_mu_init(&g_neighborhoods[i].mu);
   }
+  g_busy_poll = new BusyPollBudget(BusyPollBudget::MaxFromEnv());
   return absl::OkStatus();
 }
 
@@ -549,6 +557,8 @@ static void pollset_global_shutdown(void) {
     gpr_mu_destroy(&g_neighborhoods[i].mu);
   }
   gpr_free(g_neighborhoods);
+  delete g_busy_poll;
+  g_busy_poll = nullptr;
 }
 
 static void pollset_init(grpc_pollset* pollset, gpr_mu** mu) {
@@ -711,17 +721,35 @@ static grpc_error_handle process_epoll_events(grpc_pollset* /*pollset*/) {
 // no need for any synchronization when accesing fields in g_epoll_set
 static grpc_error_handle do_epoll_wait(grpc_pollset* ps,
                                        grpc_core::Timestamp deadline) {
-  int r;
+  int r = 0;
   int timeout = poll_deadline_to_millis_timeout(deadline);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_START_BLOCKING_REGION;
+  if (g_busy_poll->enabled() && timeout != 0) {
+    // Spin on non-blocking polls first; if that finds nothing or fails, block
+    // for whatever is left of the timeout.
+    r = g_busy_poll->Spin(
+        timeout < 0 ? BusyPollBudget::Duration(-1)
+                    : std::chrono::milliseconds(timeout),
+        []() {
+          int n;
+          do {
+            n = epoll_wait(g_epoll_set.epfd, g_epoll_set.events,
+                           MAX_EPOLL_EVENTS, 0);
+          } while (n < 0 && errno == EINTR);
+          return n;
+        });
+    timeout = poll_deadline_to_millis_timeout(deadline);
   }
-  do {
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
-  } while (r < 0 && errno == EINTR);
-  if (timeout != 0) {
-    GRPC_SCHEDULING_END_BLOCKING_REGION;
+  if (r == 0) {
+    if (timeout != 0) {
+      GRPC_SCHEDULING_START_BLOCKING_REGION;
+    }
+    do {
+      r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
+                     timeout);
+    } while (r < 0 && errno == EINTR);
+    if (timeout != 0) {
+      GRPC_SCHEDULING_END_BLOCKING_REGION;
+    }
   }
 
   if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
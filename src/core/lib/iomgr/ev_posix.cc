@@ -83,6 +83,9 @@ static const grpc_event_engine_vtable* g_vtables[] = {
 };
 
 static bool is(absl::string_view want, absl::string_view have) {
+  // iomgr has no io_uring engine; the EventEngine io_uring poller falls back
+  // to epoll1 as well when it is unavailable.
+  if (want == "io_uring") return have == "epoll1";
   return want == "all" || want == have;
 }
 
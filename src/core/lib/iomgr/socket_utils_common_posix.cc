@@ -126,6 +126,27 @@ grpc_error_handle grpc_set_socket_ip_pktinfo_if_possible(int fd) {
   return absl::OkStatus();
 }
 
+grpc_error_handle grpc_set_socket_busy_poll_if_possible(int fd,
+                                                        int busy_poll_us) {
+  // Use conditionally-important parameters to avoid warning
+  (void)fd;
+  (void)busy_poll_us;
+#ifdef SO_BUSY_POLL
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us,
+                      sizeof(busy_poll_us))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_BUSY_POLL)");
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  int prefer_busy_poll = 1;
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer_busy_poll,
+                      sizeof(prefer_busy_poll))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_PREFER_BUSY_POLL)");
+  }
+#endif
+#endif
+  return absl::OkStatus();
+}
+
 grpc_error_handle grpc_set_socket_ipv6_recvpktinfo_if_possible(int fd) {
   // Use conditionally-important parameter to avoid warning
   (void)fd;
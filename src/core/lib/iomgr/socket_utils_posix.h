@@ -193,6 +193,11 @@ grpc_error_handle grpc_set_socket_ip_pktinfo_if_possible(int fd);
 // If IPV6_RECVPKTINFO is not available, returns 1.
 grpc_error_handle grpc_set_socket_ipv6_recvpktinfo_if_possible(int fd);
 
+// Tries to set SO_BUSY_POLL to the given number of microseconds, and
+// SO_PREFER_BUSY_POLL, if available on this platform.
+grpc_error_handle grpc_set_socket_busy_poll_if_possible(int fd,
+                                                        int busy_poll_us);
+
 // Tries to set the socket's send buffer to given size.
 grpc_error_handle grpc_set_socket_sndbuf(int fd, int buffer_size_bytes);
 
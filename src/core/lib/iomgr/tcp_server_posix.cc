@@ -58,6 +58,7 @@
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/event_engine/memory_allocator_factory.h"
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/resolved_address_internal.h"
@@ -447,6 +448,15 @@ static void on_read(void* arg, grpc_error_handle err) {
     }
 
     (void)grpc_set_socket_no_sigpipe_if_possible(fd);
+    const int busy_poll_us = grpc_event_engine::experimental::BusyPollBudget::
+        SocketBusyPollMicrosFromEnv();
+    if (busy_poll_us > 0) {
+      grpc_error_handle busy_poll_err =
+          grpc_set_socket_busy_poll_if_possible(fd, busy_poll_us);
+      if (!busy_poll_err.ok()) {
+        LOG_EVERY_N_SEC(ERROR, 60) << grpc_core::StatusToString(busy_poll_err);
+      }
+    }
 
     err = grpc_apply_socket_mutator_in_args(fd, GRPC_FD_SERVER_CONNECTION_USAGE,
                                             sp->server->options);
@@ -149,12 +149,18 @@ Party::Participant::~Participant() {
 Party::~Party() {}
 
 void Party::CancelRemainingParticipants() {
-  if ((state_.load(std::memory_order_relaxed) & kAllocatedMask) == 0) return;
+  const size_t num_slots = overflow_.load(std::memory_order_acquire) == nullptr
+                               ? party_detail::kPrimaryParticipants
+                               : party_detail::kMaxParticipants;
+  if (num_slots == party_detail::kPrimaryParticipants &&
+      (state_.load(std::memory_order_relaxed) & kAllocatedMask) == 0) {
+    return;
+  }
   ScopedActivity activity(this);
   promise_detail::Context<Arena> arena_ctx(arena_.get());
-  for (size_t i = 0; i < party_detail::kMaxParticipants; i++) {
+  for (size_t i = 0; i < num_slots; i++) {
     if (auto* p =
-            participants_[i].exchange(nullptr, std::memory_order_acquire)) {
+            ParticipantSlot(i).exchange(nullptr, std::memory_order_acquire)) {
       p->Destroy();
     }
   }
@@ -167,15 +173,15 @@ std::string Party::ActivityDebugTag(WakeupMask wakeup_mask) const {
 Waker Party::MakeOwningWaker() {
   DCHECK(currently_polling_ != kNotPolling);
   IncrementRefCount();
-  return Waker(this, 1u << currently_polling_);
+  return Waker(this, WakeupMask{1} << currently_polling_);
 }
 
 Waker Party::MakeNonOwningWaker() {
   DCHECK(currently_polling_ != kNotPolling);
-  return Waker(participants_[currently_polling_]
+  return Waker(ParticipantSlot(currently_polling_)
                    .load(std::memory_order_relaxed)
                    ->MakeNonOwningWakeable(this),
-               1u << currently_polling_);
+               WakeupMask{1} << currently_polling_);
 }
 
 void Party::ForceImmediateRepoll(WakeupMask mask) {
@@ -184,7 +190,8 @@ void Party::ForceImmediateRepoll(WakeupMask mask) {
 }
 
 void Party::RunLockedAndUnref(Party* party, uint64_t prev_state) {
-  GRPC_LATENT_SEE_PARENT_SCOPE("Party::RunLocked");
+  GRPC_LATENT_SEE_PARENT_SCOPE_IF(party->latent_see_sample_.sampled(),
+                                  "Party::RunLocked");
 #ifdef GRPC_MAXIMIZE_THREADYNESS
   Thread thd(
       "RunParty",
@@ -245,7 +252,9 @@ void Party::RunLockedAndUnref(Party* party, uint64_t prev_state) {
           std::exchange(g_run_state->next, PartyWakeup{party, prev_state});
       party->arena_->GetContext<grpc_event_engine::experimental::EventEngine>()
           ->Run([wakeup]() {
-            GRPC_LATENT_SEE_PARENT_SCOPE("Party::RunLocked offload");
+            GRPC_LATENT_SEE_PARENT_SCOPE_IF(
+                wakeup.party->latent_see_sample_.sampled(),
+                "Party::RunLocked offload");
             ApplicationCallbackExecCtx app_exec_ctx;
             ExecCtx exec_ctx;
             RunState{wakeup}.Run();
@@ -260,6 +269,10 @@ void Party::RunLockedAndUnref(Party* party, uint64_t prev_state) {
 }
 
 void Party::RunPartyAndUnref(uint64_t prev_state) {
+  // Parties run back to back from one RunLocked; each decides for itself
+  // whether it is recorded.
+  GRPC_LATENT_SEE_PARENT_SCOPE_IF(latent_see_sample_.sampled(),
+                                  "Party::RunParty");
   ScopedActivity activity(this);
   promise_detail::Context<Arena> arena_ctx(arena_.get());
   DCHECK_EQ(prev_state & kLocked, 0u)
@@ -281,7 +294,8 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
         // If the participant is null, skip.
         // This allows participants to complete whilst wakers still exist
         // somewhere.
-        auto* participant = participants_[i].load(std::memory_order_acquire);
+        auto& slot = ParticipantSlot(i);
+        auto* participant = slot.load(std::memory_order_acquire);
         if (GPR_UNLIKELY(participant == nullptr)) {
           GRPC_TRACE_LOG(promise_primitives, INFO)
               << "Party " << this << "                 Run:Wakeup " << i
@@ -293,9 +307,14 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
         // Poll the participant.
         currently_polling_ = i;
         if (participant->PollParticipantPromise()) {
-          participants_[i].store(nullptr, std::memory_order_relaxed);
-          const uint64_t allocated_bit = (1u << i << kAllocatedShift);
-          keep_allocated_mask &= ~allocated_bit;
+          slot.store(nullptr, std::memory_order_relaxed);
+          if (GPR_LIKELY(i < party_detail::kPrimaryParticipants)) {
+            const uint64_t allocated_bit = (1u << i << kAllocatedShift);
+            keep_allocated_mask &= ~allocated_bit;
+          } else {
+            overflow_.load(std::memory_order_relaxed)
+                ->allocated.fetch_and(~t, std::memory_order_release);
+          }
         }
       }
     }
@@ -336,6 +355,10 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
     DCHECK_GE(prev_state & kRefMask, kOneRef);
     // From the previous state, extract which participants we're to wakeup.
     wakeup_mask_ |= prev_state & kWakeupMask;
+    if (prev_state & kOverflowWakeup) {
+      wakeup_mask_ |= overflow_.load(std::memory_order_relaxed)
+                          ->wakeups.exchange(0, std::memory_order_acquire);
+    }
     // Now update prev_state to be what we want the CAS to see once wakeups
     // complete next iteration.
     prev_state &= kRefMask | kLocked | keep_allocated_mask;
@@ -350,21 +373,25 @@ void Party::AddParticipants(Participant** participants, size_t count) {
 
   // Find slots for each new participant, ordering them from lowest available
   // slot upwards to ensure the same poll ordering as presentation ordering to
-  // this function.
+  // this function. Whatever does not fit in the primary slots goes to the
+  // overflow block, which is polled after them.
   WakeupMask wakeup_mask;
   uint64_t new_state;
+  size_t num_primary;
   do {
     wakeup_mask = 0;
+    num_primary = 0;
     allocated = (state & kAllocatedMask) >> kAllocatedShift;
-    for (size_t i = 0; i < count; i++) {
+    for (; num_primary < count; num_primary++) {
       auto new_mask = LowestOneBit(~allocated);
-      if (GPR_UNLIKELY((new_mask & kWakeupMask) == 0)) {
-        DelayAddParticipants(participants, count);
-        return;
-      }
+      if (GPR_UNLIKELY((new_mask & kWakeupMask) == 0)) break;
       wakeup_mask |= new_mask;
       allocated |= new_mask;
-      slots[i] = absl::countr_zero(new_mask);
+      slots[num_primary] = absl::countr_zero(new_mask);
+    }
+    if (GPR_UNLIKELY(num_primary == 0)) {
+      AddOverflowParticipants(participants, count);
+      return;
     }
     // Try to allocate this slot and take a ref (atomically).
     // Ref needs to be taken because once we store the participant it could be
@@ -374,7 +401,7 @@ void Party::AddParticipants(Participant** participants, size_t count) {
       state, new_state, std::memory_order_acq_rel, std::memory_order_acquire));
   LogStateChange("AddParticipantsAndRef", state, new_state);
 
-  for (size_t i = 0; i < count; i++) {
+  for (size_t i = 0; i < num_primary; i++) {
     GRPC_TRACE_LOG(party_state, INFO)
         << "Party " << this << "                 AddParticipant: " << slots[i]
         << " " << participants[i];
@@ -383,6 +410,10 @@ void Party::AddParticipants(Participant** participants, size_t count) {
 
   // Now we need to wake up the party.
   WakeupFromState(new_state, wakeup_mask);
+
+  if (GPR_UNLIKELY(num_primary < count)) {
+    AddOverflowParticipants(participants + num_primary, count - num_primary);
+  }
 }
 
 void Party::AddParticipant(Participant* participant) {
@@ -399,7 +430,7 @@ void Party::AddParticipant(Participant* participant) {
     allocated = (state & kAllocatedMask) >> kAllocatedShift;
     wakeup_mask = LowestOneBit(~allocated);
     if (GPR_UNLIKELY((wakeup_mask & kWakeupMask) == 0)) {
-      DelayAddParticipants(&participant, 1);
+      AddOverflowParticipants(&participant, 1);
       return;
     }
     DCHECK_NE(wakeup_mask & kWakeupMask, 0u)
@@ -422,6 +453,55 @@ void Party::AddParticipant(Participant* participant) {
   WakeupFromState(new_state, wakeup_mask);
 }
 
+void Party::AddOverflowParticipants(Participant** participants,
+                                    size_t count) {
+  OverflowParticipants* overflow = overflow_.load(std::memory_order_acquire);
+  if (overflow == nullptr) {
+    // If another thread installs a block first, ours is left unused on the
+    // arena.
+    auto* fresh = arena_->New<OverflowParticipants>();
+    if (overflow_.compare_exchange_strong(overflow, fresh,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire)) {
+      overflow = fresh;
+    }
+  }
+
+  size_t slots[party_detail::kMaxParticipants];
+  WakeupMask wakeup_mask;
+  WakeupMask allocated = overflow->allocated.load(std::memory_order_acquire);
+  WakeupMask new_allocated;
+  do {
+    wakeup_mask = 0;
+    // Treat the primary slots as taken so that we only find overflow ones.
+    new_allocated = allocated | kWakeupMask;
+    for (size_t i = 0; i < count; i++) {
+      auto new_mask = LowestOneBit(~new_allocated);
+      if (GPR_UNLIKELY(new_mask == 0)) {
+        DelayAddParticipants(participants, count);
+        return;
+      }
+      wakeup_mask |= new_mask;
+      new_allocated |= new_mask;
+      slots[i] = absl::countr_zero(new_mask);
+    }
+    new_allocated &= ~kWakeupMask;
+  } while (!overflow->allocated.compare_exchange_weak(
+      allocated, new_allocated, std::memory_order_acq_rel,
+      std::memory_order_acquire));
+
+  // Take the ref that waking up the new participants will drop.
+  IncrementRefCount();
+  for (size_t i = 0; i < count; i++) {
+    GRPC_TRACE_LOG(party_state, INFO)
+        << "Party " << this << "                 AddParticipant: " << slots[i]
+        << " " << participants[i];
+    ParticipantSlot(slots[i]).store(participants[i],
+                                    std::memory_order_release);
+  }
+  WakeupFromState(state_.load(std::memory_order_relaxed), wakeup_mask);
+}
+
 void Party::DelayAddParticipants(Participant** participants, size_t count) {
   // We need to delay the addition of participants.
   IncrementRefCount();
@@ -462,7 +542,8 @@ void Party::WakeupAsync(WakeupMask wakeup_mask) {
       }
     } else {
       if (state_.compare_exchange_weak(
-              prev_state, (prev_state | wakeup_mask) - kOneRef,
+              prev_state,
+              (prev_state | LockedWakeupBits(wakeup_mask)) - kOneRef,
               std::memory_order_acq_rel, std::memory_order_acquire)) {
         LogStateChange("WakeupAsync", prev_state, prev_state | wakeup_mask);
         return;
@@ -42,15 +42,21 @@
 #include "src/core/lib/promise/detail/promise_factory.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/util/latent_see.h"
 #include "src/core/util/useful.h"
 
 namespace grpc_core {
 
 namespace party_detail {
 
-// Number of bits reserved for wakeups gives us the maximum number of
-// participants.
-static constexpr size_t kMaxParticipants = 16;
+// Number of bits in a WakeupMask gives us the maximum number of participants.
+static constexpr size_t kMaxParticipants = 64;
+// The first kPrimaryParticipants participants keep their wakeup and allocation
+// bits in the party's state word. The rest live in an overflow block that is
+// allocated on the arena the first time a party needs it.
+static constexpr size_t kPrimaryParticipants = 16;
+static_assert(kMaxParticipants == sizeof(WakeupMask) * 8,
+              "one wakeup bit per participant");
 
 }  // namespace party_detail
 
@@ -94,7 +100,8 @@ class Party : public Activity, private Wakeable {
   // down.
   // The on_complete callback will be called with the result of the promise if
   // it completes.
-  // A maximum of sixteen promises can be spawned onto a party.
+  // A maximum of kMaxParticipants promises can be running on a party at once;
+  // further spawns are delayed until a slot frees up.
   // promise_factory called to create the promise with the party lock taken;
   // after the promise is created the factory is destroyed.
   // This means that pointers or references to factory members will be
@@ -113,7 +120,7 @@ class Party : public Activity, private Wakeable {
   void ForceImmediateRepoll(WakeupMask mask) final;
   WakeupMask CurrentParticipant() const final {
     DCHECK(currently_polling_ != kNotPolling);
-    return 1u << currently_polling_;
+    return WakeupMask{1} << currently_polling_;
   }
   Waker MakeOwningWaker() final;
   Waker MakeNonOwningWaker() final;
@@ -303,6 +310,7 @@ class Party : public Activity, private Wakeable {
   //   - 24 bits for ref counts
   //     1 is owned by the party prior to Orphan()
   //     All others are owned by owning wakers
+  //   - 1 bit to indicate that overflow participants have been woken up
   //   - 1 bit to indicate whether the party is locked
   //     The first thread to set this owns the party until it is unlocked
   //     That thread will run the main loop until no further work needs to
@@ -312,12 +320,17 @@ class Party : public Activity, private Wakeable {
   //   - 16 bits, one per participant, indicating which participants have
   //   been
   //     woken up and should be polled next time the main loop runs.
+  // Participants beyond the first 16 keep their allocated and woken bits in
+  // OverflowParticipants instead, and signal wakeups through the overflow
+  // wakeup bit here.
 
   // clang-format off
   // Bits used to store 16 bits of wakeups
   static constexpr uint64_t kWakeupMask    = 0x0000'0000'0000'ffff;
   // Bits used to store 16 bits of allocated participant slots.
   static constexpr uint64_t kAllocatedMask = 0x0000'0000'ffff'0000;
+  // Bit indicating that OverflowParticipants::wakeups has bits set
+  static constexpr uint64_t kOverflowWakeup = 0x0000'0001'0000'0000;
   // Bit indicating locked or not
   static constexpr uint64_t kLocked        = 0x0000'0008'0000'0000;
   // Bits used to store 24 bits of ref counts
@@ -331,10 +344,37 @@ class Party : public Activity, private Wakeable {
   // One ref count
   static constexpr uint64_t kOneRef = 1ull << kRefShift;
 
+  // Participants kPrimaryParticipants and up. Bit i of each mask refers to
+  // participant i, so the low kPrimaryParticipants bits are always zero.
+  struct OverflowParticipants {
+    std::atomic<WakeupMask> wakeups{0};
+    std::atomic<WakeupMask> allocated{0};
+    std::atomic<Participant*> participants[party_detail::kMaxParticipants -
+                                           party_detail::kPrimaryParticipants] =
+        {};
+  };
+
   // Destroy any remaining participants.
   // Needs to have normal context setup before calling.
   void CancelRemainingParticipants();
 
+  std::atomic<Participant*>& ParticipantSlot(size_t i) {
+    if (i < party_detail::kPrimaryParticipants) return participants_[i];
+    return overflow_.load(std::memory_order_acquire)
+        ->participants[i - party_detail::kPrimaryParticipants];
+  }
+
+  // State bits to set for wakeup_mask while the party is locked. Wakeups of
+  // overflow participants are recorded in the overflow block first.
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION uint64_t
+  LockedWakeupBits(WakeupMask wakeup_mask) {
+    if (GPR_LIKELY((wakeup_mask & ~kWakeupMask) == 0)) return wakeup_mask;
+    overflow_.load(std::memory_order_acquire)
+        ->wakeups.fetch_or(wakeup_mask & ~kWakeupMask,
+                           std::memory_order_relaxed);
+    return (wakeup_mask & kWakeupMask) | kOverflowWakeup;
+  }
+
   // Run the locked part of the party until it is unlocked.
   static void RunLockedAndUnref(Party* party, uint64_t prev_state);
   // Called in response to Unref() hitting zero - ultimately calls PartyOver,
@@ -354,7 +394,7 @@ class Party : public Activity, private Wakeable {
 
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void WakeupFromState(
       uint64_t cur_state, WakeupMask wakeup_mask) {
-    DCHECK_NE(wakeup_mask & kWakeupMask, 0u)
+    DCHECK_NE(wakeup_mask, 0u)
         << "Wakeup mask must be non-zero: " << wakeup_mask;
     while (true) {
       if (cur_state & kLocked) {
@@ -362,7 +402,8 @@ class Party : public Activity, private Wakeable {
         // we'll immediately unref. Since something is running this should never
         // bring the refcount to zero.
         DCHECK_GT(cur_state & kRefMask, kOneRef);
-        auto new_state = (cur_state | wakeup_mask) - kOneRef;
+        auto new_state =
+            (cur_state | LockedWakeupBits(wakeup_mask)) - kOneRef;
         if (state_.compare_exchange_weak(cur_state, new_state,
                                          std::memory_order_release)) {
           LogStateChange("Wakeup", cur_state, cur_state | wakeup_mask);
@@ -388,6 +429,8 @@ class Party : public Activity, private Wakeable {
   // Add a participant (backs Spawn, after type erasure to ParticipantFactory).
   void AddParticipants(Participant** participant, size_t count);
   void AddParticipant(Participant* participant);
+  // Add participants to the overflow block, once the primary slots are full.
+  void AddOverflowParticipants(Participant** participants, size_t count);
   void DelayAddParticipants(Participant** participant, size_t count);
 
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void LogStateChange(
@@ -404,11 +447,15 @@ class Party : public Activity, private Wakeable {
 
   std::atomic<uint64_t> state_{kOneRef};
   uint8_t currently_polling_ = kNotPolling;
+  // Whether latent_see records this party's runs.
+  GPR_NO_UNIQUE_ADDRESS latent_see::CallSample latent_see_sample_;
   WakeupMask wakeup_mask_ = 0;
   // All current participants, using a tagged format.
   // If the lower bit is unset, then this is a Participant*.
   // If the lower bit is set, then this is a ParticipantFactory*.
-  std::atomic<Participant*> participants_[party_detail::kMaxParticipants] = {};
+  std::atomic<Participant*>
+      participants_[party_detail::kPrimaryParticipants] = {};
+  std::atomic<OverflowParticipants*> overflow_{nullptr};
   RefCountedPtr<Arena> arena_;
 };
 
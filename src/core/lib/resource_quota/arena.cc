@@ -20,34 +20,169 @@
 
 #include <atomic>
 #include <new>
+#include <utility>
 
 #include "absl/log/log.h"
+#include "absl/types/optional.h"
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/alloc.h"
 namespace grpc_core {
 
 namespace {
 
+// Bytes each shard of the global pool may hold; enough for the initial zones
+// of a few hundred typical unary calls.
+constexpr size_t kGlobalPoolBytesPerShard = 256 * 1024;
+// Stop caching blocks once the pool's quota is this full.
+constexpr double kMaxCachingPressure = 0.8;
+
+std::atomic<ArenaZonePool*> g_test_only_global_pool{nullptr};
+
 void* ArenaStorage(size_t& initial_size) {
   size_t base_size = Arena::ArenaOverhead() +
                      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
                          arena_detail::BaseArenaContextTraits::ContextSize());
-  initial_size =
-      std::max(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size), base_size);
-  static constexpr size_t alignment =
-      (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
-       GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
-          ? GPR_CACHELINE_SIZE
-          : GPR_MAX_ALIGNMENT;
-  return gpr_malloc_aligned(initial_size, alignment);
+  initial_size = ArenaZonePool::BlockSize(
+      std::max(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size), base_size));
+  return ArenaZonePool::Global().Alloc(initial_size);
 }
 
 }  // namespace
 
+ArenaZonePool::ArenaZonePool(MemoryOwner owner,
+                             size_t max_cached_bytes_per_shard,
+                             size_t max_shards)
+    : owner_(std::move(owner)),
+      max_cached_bytes_per_shard_(max_cached_bytes_per_shard),
+      shards_(PerCpuOptions().SetCpusPerShard(1).SetMaxShards(max_shards)) {}
+
+ArenaZonePool::~ArenaZonePool() {
+  Drain();
+  owner_.Reset();
+}
+
+ArenaZonePool& ArenaZonePool::Global() {
+  ArenaZonePool* test_only_pool =
+      g_test_only_global_pool.load(std::memory_order_acquire);
+  if (GPR_UNLIKELY(test_only_pool != nullptr)) return *test_only_pool;
+  static NoDestruct<ArenaZonePool> pool(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryOwner(),
+      kGlobalPoolBytesPerShard);
+  return *pool;
+}
+
+void ArenaZonePool::TestOnlySetGlobal(ArenaZonePool* pool) {
+  g_test_only_global_pool.store(pool, std::memory_order_release);
+}
+
+size_t ArenaZonePool::BlockSize(size_t size) {
+  if (size > kMaxBlockSize) return size;
+  size_t block_size = kMinBlockSize;
+  while (block_size < size) block_size <<= 1;
+  return block_size;
+}
+
+size_t ArenaZonePool::SizeClass(size_t block_size) {
+  size_t size_class = 0;
+  while ((kMinBlockSize << size_class) < block_size) ++size_class;
+  return size_class;
+}
+
+void* ArenaZonePool::Alloc(size_t size) {
+  const size_t block_size = BlockSize(size);
+  if (block_size <= kMaxBlockSize) {
+    Shard& shard = shards_.this_cpu();
+    FreeBlock* block;
+    {
+      MutexLock lock(&shard.mu);
+      FreeBlock*& head = shard.free_lists[SizeClass(block_size)];
+      block = head;
+      if (block != nullptr) {
+        head = block->next;
+        shard.bytes -= block_size;
+      }
+    }
+    if (block != nullptr) {
+      owner_.Release(block_size);
+      return block;
+    }
+  }
+  return gpr_malloc_aligned(block_size, kAlignment);
+}
+
+void ArenaZonePool::Free(void* p, size_t size) {
+  const size_t block_size = BlockSize(size);
+  if (block_size > kMaxBlockSize ||
+      owner_.GetPressureInfo().instantaneous_pressure > kMaxCachingPressure) {
+    gpr_free_aligned(p);
+    return;
+  }
+  Shard& shard = shards_.this_cpu();
+  {
+    MutexLock lock(&shard.mu);
+    if (shard.bytes + block_size <= max_cached_bytes_per_shard_) {
+      FreeBlock*& head = shard.free_lists[SizeClass(block_size)];
+      head = new (p) FreeBlock{head};
+      shard.bytes += block_size;
+      p = nullptr;
+    }
+  }
+  if (p != nullptr) {
+    gpr_free_aligned(p);
+    return;
+  }
+  owner_.Reserve(block_size);
+  MaybePostReclaimer();
+}
+
+size_t ArenaZonePool::Drain() {
+  size_t released = 0;
+  for (Shard& shard : shards_) {
+    FreeBlock* free_lists[kNumClasses];
+    {
+      MutexLock lock(&shard.mu);
+      for (size_t i = 0; i < kNumClasses; ++i) {
+        free_lists[i] = std::exchange(shard.free_lists[i], nullptr);
+      }
+      released += std::exchange(shard.bytes, 0);
+    }
+    for (FreeBlock* head : free_lists) {
+      while (head != nullptr) gpr_free_aligned(std::exchange(head, head->next));
+    }
+  }
+  if (released != 0) owner_.Release(released);
+  return released;
+}
+
+size_t ArenaZonePool::cached_bytes() {
+  size_t bytes = 0;
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    bytes += shard.bytes;
+  }
+  return bytes;
+}
+
+void ArenaZonePool::MaybePostReclaimer() {
+  if (reclaimer_posted_.load(std::memory_order_relaxed) ||
+      reclaimer_posted_.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
+  owner_.PostReclaimer(
+      ReclamationPass::kBenign,
+      [this](absl::optional<ReclamationSweep> sweep) {
+        // A cancelled reclaimer must not stop the next one being posted.
+        reclaimer_posted_.store(false, std::memory_order_release);
+        if (!sweep.has_value()) return;
+        Drain();
+      });
+}
+
 Arena::~Arena() {
   for (size_t i = 0; i < arena_detail::BaseArenaContextTraits::NumContexts();
        ++i) {
@@ -101,8 +236,9 @@ void Arena::DestroyManagedNewObjects() {
 }
 
 void Arena::Destroy() const {
+  const size_t initial_zone_size = initial_zone_size_;
   this->~Arena();
-  gpr_free_aligned(const_cast<Arena*>(this));
+  ArenaZonePool::Global().Free(const_cast<Arena*>(this), initial_zone_size);
 }
 
 void* Arena::AllocZone(size_t size) {
@@ -35,7 +35,11 @@
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/support/port_platform.h>
 
+#include "absl/base/thread_annotations.h"
+
 #include "src/core/lib/gprpp/construct_destruct.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/util/alloc.h"
@@ -118,6 +122,79 @@ struct UnrefDestroy {
 
 }  // namespace arena_detail
 
+// Recycles the initial zones of arenas across calls, so that steady state call
+// churn does not need to go to malloc. (Later zones are sized exactly to the
+// allocation that overflowed, and are rare once call sizing has settled, so
+// they are not pooled.)
+//
+// Blocks are cached in per-cpu shards, in power of two size classes from
+// kMinBlockSize to kMaxBlockSize; larger blocks bypass the pool. While cached,
+// blocks are reserved against the pool's memory quota: nothing is cached once
+// that quota is under pressure, and a benign reclaimer empties the pool when
+// the quota needs memory back.
+class ArenaZonePool {
+ public:
+  static constexpr size_t kMinBlockSize = 256;
+  static constexpr size_t kMaxBlockSize = 64 * 1024;
+  static constexpr size_t kAlignment =
+      (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
+       GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
+          ? GPR_CACHELINE_SIZE
+          : GPR_MAX_ALIGNMENT;
+
+  static constexpr size_t kMaxShards = 32;
+
+  // Cached bytes are reserved from owner. The pool must outlive any
+  // reclamation sweep that it is running.
+  ArenaZonePool(MemoryOwner owner, size_t max_cached_bytes_per_shard,
+                size_t max_shards = kMaxShards);
+  ~ArenaZonePool();
+
+  ArenaZonePool(const ArenaZonePool&) = delete;
+  ArenaZonePool& operator=(const ArenaZonePool&) = delete;
+
+  // The pool used by all arenas, reserving against the default resource
+  // quota.
+  static ArenaZonePool& Global();
+  // Makes Global() return pool instead, until called again with nullptr.
+  static void TestOnlySetGlobal(ArenaZonePool* pool);
+
+  // The size of the block that Alloc(size) returns.
+  static size_t BlockSize(size_t size);
+
+  // Returns a block of BlockSize(size) bytes aligned to kAlignment.
+  void* Alloc(size_t size);
+  // Returns a block obtained from Alloc(size).
+  void Free(void* p, size_t size);
+  // Frees every cached block, returning the number of bytes released.
+  size_t Drain();
+
+  size_t cached_bytes();
+
+ private:
+  static constexpr size_t kNumClasses = 9;
+  static_assert(kMinBlockSize << (kNumClasses - 1) == kMaxBlockSize,
+                "size classes must span kMinBlockSize to kMaxBlockSize");
+
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  struct Shard {
+    Mutex mu;
+    FreeBlock* free_lists[kNumClasses] ABSL_GUARDED_BY(mu) = {};
+    size_t bytes ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  static size_t SizeClass(size_t block_size);
+  void MaybePostReclaimer();
+
+  MemoryOwner owner_;
+  const size_t max_cached_bytes_per_shard_;
+  std::atomic<bool> reclaimer_posted_{false};
+  PerCpu<Shard> shards_;
+};
+
 class ArenaFactory : public RefCounted<ArenaFactory> {
  public:
   virtual RefCountedPtr<Arena> MakeArena() = 0;
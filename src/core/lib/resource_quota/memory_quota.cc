@@ -54,6 +54,12 @@ constexpr size_t kMaxReplenishBytes = 1024 * 1024;
 // Minimum number of bytes an allocator will request from a quota in one step.
 constexpr size_t kMinReplenishBytes = 4096;
 
+// Largest chunk moved between a quota and one of its per cpu caches.
+constexpr size_t kMaxCpuCacheChunk = 256 * 1024;
+// Each cpu may hold up to two chunks, and all of the caches together at most
+// 1/kCpuCacheQuotaFraction of the quota.
+constexpr size_t kCpuCacheQuotaFraction = 64;
+
 class MemoryQuotaTracker {
  public:
   static MemoryQuotaTracker& Get() {
@@ -414,7 +420,10 @@ class BasicMemoryQuota::WaitForSweepPromise {
   uint64_t token_;
 };
 
-BasicMemoryQuota::BasicMemoryQuota(std::string name) : name_(std::move(name)) {}
+BasicMemoryQuota::BasicMemoryQuota(std::string name) : name_(std::move(name)) {
+  cpu_cache_chunk_.store(CpuCacheChunk(kInitialSize),
+                         std::memory_order_relaxed);
+}
 
 void BasicMemoryQuota::Start() {
   auto self = shared_from_this();
@@ -485,6 +494,10 @@ void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
 
 void BasicMemoryQuota::SetSize(size_t new_size) {
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
+  // Resize the cpu caches for the new quota before applying it, so that a
+  // shrinking quota cannot leave them holding its free bytes.
+  cpu_cache_chunk_.store(CpuCacheChunk(new_size), std::memory_order_relaxed);
+  FlushCpuCaches();
   if (old_size < new_size) {
     // We're growing the quota.
     Return(new_size - old_size);
@@ -498,11 +511,18 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   // If there's a request for nothing, then do nothing!
   if (amount == 0) return;
   DCHECK(amount <= std::numeric_limits<intptr_t>::max());
-  // Grab memory from the quota.
-  auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
-  // If we push into overcommit, awake the reclaimer.
-  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
-    if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+  if (allocator == nullptr || !TakeFromCpuCache(amount)) {
+    // Grab memory from the quota.
+    auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
+    // If we push into overcommit, first bring back whatever the cpu caches
+    // are holding, and if that's not enough awake the reclaimer.
+    if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
+      FlushCpuCaches();
+      if (free_bytes_.load(std::memory_order_acquire) < 0 &&
+          reclaimer_activity_ != nullptr) {
+        reclaimer_activity_->ForceWakeup();
+      }
+    }
   }
 
   if (IsFreeLargeAllocatorEnabled()) {
@@ -543,9 +563,69 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 }
 
 void BasicMemoryQuota::Return(size_t amount) {
+  if (ReturnToCpuCache(amount)) return;
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
 }
 
+size_t BasicMemoryQuota::CpuCacheChunk(size_t quota_size) {
+  const size_t num_caches = cpu_caches_.end() - cpu_caches_.begin();
+  const size_t chunk =
+      std::min(kMaxCpuCacheChunk,
+               quota_size / (kCpuCacheQuotaFraction * 2 * num_caches));
+  return chunk < kMinReplenishBytes ? 0 : chunk;
+}
+
+bool BasicMemoryQuota::TakeFromCpuCache(size_t amount) {
+  const size_t chunk = cpu_cache_chunk_.load(std::memory_order_relaxed);
+  if (amount > chunk) return false;
+  CpuCache& cache = cpu_caches_.this_cpu();
+  intptr_t available = cache.free_bytes.load(std::memory_order_relaxed);
+  while (available >= static_cast<intptr_t>(amount)) {
+    if (cache.free_bytes.compare_exchange_weak(available, available - amount,
+                                               std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  // Refill the cache with a chunk, unless that would need overcommit: the
+  // slow path in Take deals with that.
+  intptr_t free = free_bytes_.load(std::memory_order_relaxed);
+  while (free >= static_cast<intptr_t>(chunk)) {
+    if (free_bytes_.compare_exchange_weak(free, free - chunk,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed)) {
+      cache.free_bytes.fetch_add(chunk - amount, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BasicMemoryQuota::ReturnToCpuCache(size_t amount) {
+  const size_t chunk = cpu_cache_chunk_.load(std::memory_order_relaxed);
+  if (chunk == 0) return false;
+  CpuCache& cache = cpu_caches_.this_cpu();
+  intptr_t cached =
+      cache.free_bytes.fetch_add(amount, std::memory_order_relaxed) + amount;
+  // Spill everything above one chunk back to the quota once two are cached.
+  while (cached > static_cast<intptr_t>(2 * chunk)) {
+    const intptr_t spill = cached - chunk;
+    if (cache.free_bytes.compare_exchange_weak(cached, chunk,
+                                               std::memory_order_relaxed)) {
+      free_bytes_.fetch_add(spill, std::memory_order_relaxed);
+      break;
+    }
+  }
+  return true;
+}
+
+void BasicMemoryQuota::FlushCpuCaches() {
+  for (CpuCache& cache : cpu_caches_) {
+    const intptr_t cached =
+        cache.free_bytes.exchange(0, std::memory_order_relaxed);
+    if (cached != 0) free_bytes_.fetch_add(cached, std::memory_order_relaxed);
+  }
+}
+
 void BasicMemoryQuota::AddNewAllocator(GrpcMemoryAllocatorImpl* allocator) {
   GRPC_TRACE_LOG(resource_quota, INFO) << "Adding allocator " << allocator;
 
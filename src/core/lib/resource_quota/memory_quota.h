@@ -40,6 +40,7 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
@@ -350,8 +351,29 @@ class BasicMemoryQuota final
     std::array<Shard, 16> shards;
   };
 
+  // Free bytes pulled out of free_bytes_ in chunks and held per cpu, so that
+  // allocators taking and returning memory on different cpus do not all
+  // contend on free_bytes_. Bytes held here are not counted as free by
+  // GetPressureInfo, which errs towards reporting a little more pressure.
+  struct alignas(GPR_CACHELINE_SIZE) CpuCache {
+    std::atomic<intptr_t> free_bytes{0};
+  };
+
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
 
+  // The chunk size for cpu caches of a quota of quota_size, or zero if the
+  // quota is too small to be worth caching.
+  size_t CpuCacheChunk(size_t quota_size);
+  // Take amount from this cpu's cache, refilling it from free_bytes_ if
+  // that can be done without entering overcommit. Returns false if the
+  // caller should take from free_bytes_ directly.
+  bool TakeFromCpuCache(size_t amount);
+  // Return amount to this cpu's cache, spilling back to free_bytes_ if the
+  // cache grows beyond two chunks. Returns false if caching is disabled.
+  bool ReturnToCpuCache(size_t amount);
+  // Move every cached byte back into free_bytes_.
+  void FlushCpuCaches();
+
   // Move allocator from big bucket to small bucket.
   void MaybeMoveAllocatorBigToSmall(GrpcMemoryAllocatorImpl* allocator);
   // Move allocator from small bucket to big bucket.
@@ -363,6 +385,10 @@ class BasicMemoryQuota final
   std::atomic<intptr_t> free_bytes_{kInitialSize};
   // The total number of bytes in this quota.
   std::atomic<size_t> quota_size_{kInitialSize};
+  PerCpu<CpuCache> cpu_caches_{
+      PerCpuOptions().SetCpusPerShard(1).SetMaxShards(64)};
+  // Size of the chunks moved between free_bytes_ and cpu_caches_.
+  std::atomic<size_t> cpu_cache_chunk_{0};
 
   // Reclaimer queues.
   ReclaimerQueue reclaimers_[kNumReclamationPasses];
@@ -0,0 +1,95 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/slice/interned_slice.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/base/no_destructor.h"
+#include "absl/hash/hash.h"
+
+#include <grpc/slice.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/resource_quota/resource_quota.h"
+
+namespace grpc_core {
+
+namespace {
+// The memory charged for an entry: its bytes with their refcount, the list
+// node and the index slot.
+size_t EntrySize(absl::string_view s) {
+  return s.size() + sizeof(grpc_slice_refcount) + sizeof(Slice) +
+         2 * sizeof(void*) +
+         sizeof(std::pair<absl::string_view, std::list<Slice>::iterator>);
+}
+}  // namespace
+
+InternedSliceTable::InternedSliceTable(MemoryAllocator allocator,
+                                       size_t max_entries_per_shard)
+    : allocator_(std::move(allocator)),
+      max_entries_per_shard_(std::max<size_t>(max_entries_per_shard, 1)),
+      shards_(new Shard[kShards]) {}
+
+InternedSliceTable::~InternedSliceTable() {
+  for (size_t i = 0; i < kShards; i++) {
+    MutexLock lock(&shards_[i].mu);
+    allocator_.Release(shards_[i].bytes);
+  }
+}
+
+InternedSliceTable& InternedSliceTable::Global() {
+  static absl::NoDestructor<InternedSliceTable> table(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "interned_slices"));
+  return *table;
+}
+
+Slice InternedSliceTable::Intern(absl::string_view s) {
+  if (s.size() <= GRPC_SLICE_INLINED_SIZE || s.size() > kMaxInternedLength) {
+    return Slice::FromCopiedString(s);
+  }
+  Shard& shard = shards_[absl::HashOf(s) % kShards];
+  MutexLock lock(&shard.mu);
+  auto it = shard.index.find(s);
+  if (it != shard.index.end()) {
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    return it->second->Ref();
+  }
+  if (shard.lru.size() == max_entries_per_shard_) {
+    const size_t evicted = EntrySize(shard.lru.back().as_string_view());
+    shard.index.erase(shard.lru.back().as_string_view());
+    shard.lru.pop_back();
+    allocator_.Release(evicted);
+    shard.bytes -= evicted;
+  }
+  const size_t entry_size = EntrySize(s);
+  allocator_.Reserve(entry_size);
+  shard.bytes += entry_size;
+  shard.lru.push_front(Slice::FromCopiedString(s));
+  shard.index.emplace(shard.lru.front().as_string_view(), shard.lru.begin());
+  return shard.lru.front().Ref();
+}
+
+size_t InternedSliceTable::size() {
+  size_t total = 0;
+  for (size_t i = 0; i < kShards; i++) {
+    MutexLock lock(&shards_[i].mu);
+    total += shards_[i].lru.size();
+  }
+  return total;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,96 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SLICE_INTERNED_SLICE_H
+#define GRPC_SRC_CORE_LIB_SLICE_INTERNED_SLICE_H
+
+#include <stddef.h>
+
+#include <list>
+#include <memory>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+
+// A table of refcounted slices shared by content.
+//
+// Intern() returns a new reference to the table's slice for a string, adding
+// one if there is none, so that strings seen over and over (custom metadata
+// keys, say) cost a refcount increment rather than an allocation each time.
+// Each shard keeps at most max_entries_per_shard slices and drops the least
+// recently interned one when it is full; slices handed out stay valid, they
+// just stop being shared with later callers.
+//
+// Strings short enough to be inlined in a slice never allocate, so they are
+// copied rather than looked up. So are strings longer than
+// kMaxInternedLength: those are rarely repeated, and a peer sending random
+// long keys must not be able to pin much memory in the table.
+//
+// The memory held by the table is charged to the allocator it is given.
+class InternedSliceTable {
+ public:
+  static constexpr size_t kShards = 16;
+  static constexpr size_t kDefaultMaxEntriesPerShard = 256;
+  static constexpr size_t kMaxInternedLength = 64;
+
+  explicit InternedSliceTable(
+      MemoryAllocator allocator,
+      size_t max_entries_per_shard = kDefaultMaxEntriesPerShard);
+  ~InternedSliceTable();
+
+  InternedSliceTable(const InternedSliceTable&) = delete;
+  InternedSliceTable& operator=(const InternedSliceTable&) = delete;
+
+  // The table used by InternSlice(), charged to the default resource quota.
+  static InternedSliceTable& Global();
+
+  Slice Intern(absl::string_view s);
+
+  // The number of slices held by the table.
+  size_t size();
+
+ private:
+  struct Shard {
+    Mutex mu;
+    // Most recently interned first.
+    std::list<Slice> lru ABSL_GUARDED_BY(mu);
+    // Keys point into the bytes of the slices in lru.
+    absl::flat_hash_map<absl::string_view, std::list<Slice>::iterator> index
+        ABSL_GUARDED_BY(mu);
+    // Bytes reserved from allocator_ for the entries above.
+    size_t bytes ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  MemoryAllocator allocator_;
+  const size_t max_entries_per_shard_;
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+// Interns s in the global table.
+inline Slice InternSlice(absl::string_view s) {
+  return InternedSliceTable::Global().Intern(s);
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SLICE_INTERNED_SLICE_H
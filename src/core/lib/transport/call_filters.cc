@@ -21,6 +21,7 @@
 
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/transport/metadata.h"
+#include "src/core/util/latent_see.h"
 
 namespace grpc_core {
 
@@ -28,6 +29,7 @@ namespace filters_detail {
 
 void RunHalfClose(absl::Span<const HalfCloseOperator> ops, void* call_data) {
   for (const auto& op : ops) {
+    GRPC_LATENT_SEE_INNER_SCOPE("CallFilters::HalfClose");
     op.half_close(Offset(call_data, op.call_offset), op.channel_data);
   }
 }
@@ -36,6 +38,7 @@ ServerMetadataHandle RunServerTrailingMetadata(
     absl::Span<const ServerTrailingMetadataOperator> ops, void* call_data,
     ServerMetadataHandle md) {
   for (auto& op : ops) {
+    GRPC_LATENT_SEE_INNER_SCOPE("CallFilters::ServerTrailingMetadata");
     md = op.server_trailing_metadata(Offset(call_data, op.call_offset),
                                      op.channel_data, std::move(md));
   }
@@ -73,6 +76,8 @@ Poll<ResultOr<T>> OperationExecutor<T>::InitStep(T input, void* call_data) {
     if (ops_ == end_ops_) {
       return ResultOr<T>{std::move(input), nullptr};
     }
+    // One span per filter: each op belongs to the next filter in the stack.
+    GRPC_LATENT_SEE_INNER_SCOPE("CallFilters::Op");
     auto p =
         ops_->promise_init(promise_data_, Offset(call_data, ops_->call_offset),
                            ops_->channel_data, std::move(input));
@@ -99,7 +104,10 @@ Poll<ResultOr<T>> OperationExecutor<T>::Step(void* call_data) {
 
 template <typename T>
 Poll<ResultOr<T>> OperationExecutor<T>::ContinueStep(void* call_data) {
-  auto p = ops_->poll(promise_data_);
+  auto p = [this]() {
+    GRPC_LATENT_SEE_INNER_SCOPE("CallFilters::OpPoll");
+    return ops_->poll(promise_data_);
+  }();
   if (auto* r = p.value_if_ready()) {
     if (r->ok == nullptr) return std::move(*r);
     ++ops_;
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <string>
+#include <utility>
 
 #include "absl/base/no_destructor.h"
 #include "absl/container/flat_hash_set.h"
@@ -28,6 +29,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/slice/interned_slice.h"
 #include "src/core/lib/transport/timeout_encoding.h"
 
 namespace grpc_core {
@@ -63,6 +65,7 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
         allow_list.insert(std::string(GrpcRetryPushbackMsMetadata::key()));
         allow_list.insert(std::string(GrpcServerStatsBinMetadata::key()));
         allow_list.insert(std::string(GrpcStatusMetadata::key()));
+        allow_list.insert(std::string(GrpcStreamCompressionMetadata::key()));
         allow_list.insert(std::string(GrpcTagsBinMetadata::key()));
         allow_list.insert(std::string(GrpcTimeoutMetadata::key()));
         allow_list.insert(std::string(GrpcTraceBinMetadata::key()));
@@ -96,7 +99,11 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
 }
 
 void UnknownMap::Append(absl::string_view key, Slice value) {
-  unknown_.emplace_back(Slice::FromCopiedString(key), value.Ref());
+  unknown_.emplace_back(InternSlice(key), std::move(value));
+}
+
+void UnknownMap::Append(Slice key, Slice value) {
+  unknown_.emplace_back(std::move(key), std::move(value));
 }
 
 void UnknownMap::Remove(absl::string_view key) {
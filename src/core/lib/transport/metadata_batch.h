@@ -46,6 +46,7 @@
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/type_list.h"
 #include "src/core/lib/promise/poll.h"
+#include "src/core/lib/slice/interned_slice.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/custom_metadata.h"
 #include "src/core/lib/transport/metadata_compression_traits.h"
@@ -388,6 +389,18 @@ struct GrpcPreviousRpcAttemptsMetadata
   static absl::string_view key() { return "grpc-previous-rpc-attempts"; }
 };
 
+// grpc-stream-compression metadata trait.
+// In client initial metadata, says that the client accepts server messages
+// compressed as one stream; in server initial metadata, that the server's
+// messages on this call are. The only valid value is 1.
+struct GrpcStreamCompressionMetadata
+    : public SimpleIntBasedMetadata<uint32_t, 0> {
+  static constexpr bool kRepeatable = false;
+  static constexpr bool kTransferOnTrailersOnly = false;
+  using CompressionTraits = StableValueCompressor;
+  static absl::string_view key() { return "grpc-stream-compression"; }
+};
+
 // grpc-retry-pushback-ms metadata trait.
 struct GrpcRetryPushbackMsMetadata {
   static constexpr bool kRepeatable = false;
@@ -683,8 +696,7 @@ class ParseHelper {
   GPR_ATTRIBUTE_NOINLINE ParsedMetadata<Container> NotFound(
       absl::string_view key) {
     return ParsedMetadata<Container>(
-        typename ParsedMetadata<Container>::FromSlicePair{},
-        Slice::FromCopiedString(key),
+        typename ParsedMetadata<Container>::FromSlicePair{}, InternSlice(key),
         will_keep_past_request_lifetime_ ? value_.TakeUniquelyOwned()
                                          : std::move(value_),
         transport_size_);
@@ -1013,7 +1025,7 @@ class CopySink {
   }
 
   void Encode(const Slice& key, const Slice& value) {
-    dst_->unknown_.Append(key.as_string_view(), value.Ref());
+    dst_->unknown_.Append(key.Ref(), value.Ref());
   }
 
  private:
@@ -1105,7 +1117,11 @@ class UnknownMap {
  public:
   using BackingType = std::vector<std::pair<Slice, Slice>>;
 
+  // Keys are interned (see InternSlice()), so that the same custom key on
+  // every call does not allocate each time.
   void Append(absl::string_view key, Slice value);
+  // Takes a reference to an already owned key.
+  void Append(Slice key, Slice value);
   void Remove(absl::string_view key);
   absl::optional<absl::string_view> GetStringValue(absl::string_view key,
                                                    std::string* backing) const;
@@ -1578,7 +1594,8 @@ using grpc_metadata_batch_base = grpc_core::MetadataMap<
     grpc_core::GrpcEncodingMetadata, grpc_core::GrpcInternalEncodingRequest,
     grpc_core::GrpcAcceptEncodingMetadata, grpc_core::GrpcStatusMetadata,
     grpc_core::GrpcTimeoutMetadata, grpc_core::GrpcPreviousRpcAttemptsMetadata,
-    grpc_core::GrpcRetryPushbackMsMetadata, grpc_core::UserAgentMetadata,
+    grpc_core::GrpcRetryPushbackMsMetadata,
+    grpc_core::GrpcStreamCompressionMetadata, grpc_core::UserAgentMetadata,
     grpc_core::GrpcMessageMetadata, grpc_core::HostMetadata,
     grpc_core::EndpointLoadMetricsBinMetadata,
     grpc_core::GrpcServerStatsBinMetadata, grpc_core::GrpcTraceBinMetadata,
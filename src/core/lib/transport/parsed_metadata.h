@@ -394,7 +394,7 @@ ParsedMetadata<MetadataContainer>::KeyValueVTable(absl::string_view key) {
   };
   static const auto set = [](const Buffer& value, MetadataContainer* map) {
     auto* p = static_cast<KV*>(value.pointer);
-    map->unknown_.Append(p->first.as_string_view(), p->second.Ref());
+    map->unknown_.Append(p->first.Ref(), p->second.Ref());
   };
   static const auto with_new_value =
       [](Slice* value, bool will_keep_past_request_lifetime,
@@ -0,0 +1,127 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/load_balancing/ring_hash/ketama_ring.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/xxhash_inline.h"
+
+namespace grpc_core {
+
+KetamaRing::KetamaRing(std::vector<Endpoint> endpoints,
+                       const KetamaRing* previous) {
+  // Find the endpoints that have the same address and number of hashes as
+  // in the previous ring.  Their hashes are the same, so they are copied
+  // from the previous ring instead of being computed again.
+  constexpr size_t kNotKept = std::numeric_limits<size_t>::max();
+  std::vector<size_t> kept_indices;  // Indexed by the previous endpoint index.
+  absl::flat_hash_map<absl::string_view, size_t> previous_indices;
+  if (previous != nullptr) {
+    kept_indices.assign(previous->endpoints_.size(), kNotKept);
+    previous_indices.reserve(previous->endpoints_.size());
+    for (size_t i = 0; i < previous->endpoints_.size(); ++i) {
+      previous_indices.emplace(previous->endpoints_[i].address, i);
+    }
+  }
+  // Compute the hashes of the other endpoints.
+  std::vector<Entry> added;
+  absl::InlinedVector<char, 196> hash_key_buffer;
+  size_t ring_size = 0;
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    const Endpoint& endpoint = endpoints[i];
+    ring_size += endpoint.count;
+    auto it = previous_indices.find(endpoint.address);
+    if (it != previous_indices.end() &&
+        previous->endpoints_[it->second].count == endpoint.count &&
+        kept_indices[it->second] == kNotKept) {
+      kept_indices[it->second] = i;
+      continue;
+    }
+    hash_key_buffer.assign(endpoint.address.begin(), endpoint.address.end());
+    hash_key_buffer.emplace_back('_');
+    auto offset_start = hash_key_buffer.end();
+    for (size_t count = 0; count < endpoint.count; ++count) {
+      const std::string count_str = absl::StrCat(count);
+      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
+      absl::string_view hash_key(hash_key_buffer.data(),
+                                 hash_key_buffer.size());
+      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
+      added.push_back({hash, i});
+      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
+    }
+  }
+  const auto by_hash = [](const Entry& lhs, const Entry& rhs) {
+    return lhs.hash < rhs.hash;
+  };
+  std::sort(added.begin(), added.end(), by_hash);
+  // Merge the new hashes into the kept ones, which are already sorted.
+  ring_.reserve(ring_size);
+  auto next_added = added.begin();
+  if (previous != nullptr) {
+    for (const Entry& entry : previous->ring_) {
+      const size_t index = kept_indices[entry.endpoint_index];
+      if (index == kNotKept) continue;
+      for (; next_added != added.end() && by_hash(*next_added, entry);
+           ++next_added) {
+        ring_.push_back(*next_added);
+      }
+      ring_.push_back({entry.hash, index});
+    }
+  }
+  ring_.insert(ring_.end(), next_added, added.end());
+  endpoints_ = std::move(endpoints);
+}
+
+size_t KetamaRing::FindPosition(uint64_t request_hash) const {
+  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
+  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
+  // for lowp, highp, and index. Do not change them!
+  int64_t lowp = 0;
+  int64_t highp = ring_.size();
+  int64_t index = 0;
+  while (true) {
+    index = (lowp + highp) / 2;
+    if (index == static_cast<int64_t>(ring_.size())) {
+      index = 0;
+      break;
+    }
+    uint64_t midval = ring_[index].hash;
+    uint64_t midval1 = index == 0 ? 0 : ring_[index - 1].hash;
+    if (request_hash <= midval && request_hash > midval1) {
+      break;
+    }
+    if (midval < request_hash) {
+      lowp = index + 1;
+    } else {
+      highp = index - 1;
+    }
+    if (lowp > highp) {
+      index = 0;
+      break;
+    }
+  }
+  return index;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,79 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_KETAMA_RING_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_KETAMA_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+
+// A consistent hashing ring, as built by libketama: every endpoint has a
+// number of hashes on the ring, and a request goes to the endpoint of the
+// first hash at or after its own.
+//
+// A ring can be built from the ring of a previous list of endpoints. The
+// hashes of endpoints with the same address and number of hashes in both
+// are copied from the previous ring rather than computed again, and only the
+// other endpoints' hashes are computed and sorted. The result is the same
+// ring a full build gives.
+class KetamaRing {
+ public:
+  struct Endpoint {
+    // Determines the endpoint's hashes.
+    std::string address;
+    // The number of hashes the endpoint has on the ring.
+    size_t count;
+  };
+
+  struct Entry {
+    uint64_t hash;
+    // Index into the endpoints the ring was built from.
+    size_t endpoint_index;
+  };
+
+  // Builds the ring for 'endpoints'. 'previous', if non-null, is the ring of
+  // an earlier list of endpoints, to copy unchanged endpoints' hashes from.
+  explicit KetamaRing(std::vector<Endpoint> endpoints,
+                      const KetamaRing* previous = nullptr);
+
+  // The number of positions on the ring.
+  size_t size() const { return ring_.size(); }
+
+  // Returns the position of the first endpoint to try for request_hash.
+  size_t FindPosition(uint64_t request_hash) const;
+
+  // Returns the index into the endpoints the ring was built from of the
+  // endpoint at position.
+  size_t EndpointIndex(size_t position) const {
+    return ring_[position].endpoint_index;
+  }
+
+  // The ring's entries, sorted by hash.
+  const std::vector<Entry>& entries() const { return ring_; }
+
+ private:
+  std::vector<Endpoint> endpoints_;
+  std::vector<Entry> ring_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_KETAMA_RING_H
@@ -0,0 +1,93 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/load_balancing/ring_hash/maglev_table.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "absl/log/check.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/xxhash_inline.h"
+
+namespace grpc_core {
+
+namespace {
+constexpr uint32_t kEmptySlot = std::numeric_limits<uint32_t>::max();
+}  // namespace
+
+bool MaglevTable::IsPrime(uint64_t n) {
+  if (n < 2) return false;
+  for (uint64_t d = 2; d * d <= n; ++d) {
+    if (n % d == 0) return false;
+  }
+  return true;
+}
+
+MaglevTable::MaglevTable(absl::Span<const Endpoint> endpoints,
+                         uint64_t table_size) {
+  if (endpoints.empty()) return;
+  DCHECK(IsPrime(table_size));
+  CHECK_LT(endpoints.size(), kEmptySlot);
+  struct BuildEntry {
+    size_t index;  // Index into endpoints.
+    uint64_t offset;
+    uint64_t skip;
+    uint64_t weight;
+    // The endpoint claims its next slot once the round times its weight
+    // reaches this.
+    uint64_t target_weight = 0;
+    // The position in the endpoint's permutation to try next.
+    uint64_t next = 0;
+  };
+  std::vector<BuildEntry> entries;
+  entries.reserve(endpoints.size());
+  uint64_t max_weight = 0;
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    const std::string& key = endpoints[i].key;
+    const uint64_t weight = std::max<uint32_t>(endpoints[i].weight, 1);
+    entries.push_back({i, XXH64(key.data(), key.size(), 0) % table_size,
+                       XXH64(key.data(), key.size(), 1) % (table_size - 1) + 1,
+                       weight});
+    max_weight = std::max(max_weight, weight);
+  }
+  // Endpoints that want the same slot in the same round get it in key order,
+  // which makes the table independent of the order of the endpoints.
+  std::sort(entries.begin(), entries.end(),
+            [&](const BuildEntry& lhs, const BuildEntry& rhs) {
+              return endpoints[lhs.index].key < endpoints[rhs.index].key;
+            });
+  table_.assign(table_size, kEmptySlot);
+  uint64_t filled = 0;
+  // An endpoint with the largest weight claims a slot in every round; one
+  // with a third of that weight claims a slot every third round.
+  for (uint64_t round = 1; filled < table_size; ++round) {
+    for (BuildEntry& entry : entries) {
+      if (filled == table_size) break;
+      if (round * entry.weight < entry.target_weight) continue;
+      entry.target_weight += max_weight;
+      uint64_t slot;
+      do {
+        slot = (entry.offset + entry.skip * entry.next) % table_size;
+        ++entry.next;
+      } while (table_[slot] != kEmptySlot);
+      table_[slot] = static_cast<uint32_t>(entry.index);
+      ++filled;
+    }
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,81 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_MAGLEV_TABLE_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_MAGLEV_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+
+// A Maglev lookup table, as described in "Maglev: A Fast and Reliable
+// Software Network Load Balancer" (NSDI 2016) and used by Envoy's MAGLEV
+// load balancer.
+//
+// Every endpoint has its own permutation of the slots of a table of prime
+// size, derived from the hash of its key. The endpoints take turns, in
+// proportion to their weights, claiming the next free slot of their
+// permutation until the table is full. A lookup is a single index into the
+// table, the table's memory depends only on its size, and adding or removing
+// an endpoint moves few slots other than the ones it gains or loses.
+class MaglevTable {
+ public:
+  // The table size used by Envoy's MAGLEV load balancer by default.
+  static constexpr uint64_t kDefaultTableSize = 65537;
+  // The largest table size that Envoy accepts.
+  static constexpr uint64_t kMaxTableSize = 5000011;
+
+  struct Endpoint {
+    // Determines the endpoint's permutation, so it must identify the
+    // endpoint across updates, e.g. its address.
+    std::string key;
+    // Endpoints are given slots in proportion to their weights. Must be
+    // non-zero.
+    uint32_t weight = 1;
+  };
+
+  // Builds a table of 'table_size' slots, which must be prime. The table
+  // depends only on the keys and weights of 'endpoints', not their order.
+  // An empty list of endpoints gives an empty table.
+  MaglevTable(absl::Span<const Endpoint> endpoints, uint64_t table_size);
+
+  static bool IsPrime(uint64_t n);
+
+  size_t size() const { return table_.size(); }
+
+  // Returns the slot to look up for a request hash.
+  size_t Slot(uint64_t hash) const { return hash % table_.size(); }
+
+  // Returns the index into the endpoints the table was built from of the
+  // endpoint that owns 'slot'.
+  size_t EndpointIndex(size_t slot) const { return table_[slot]; }
+
+  // Bytes of memory used by the table.
+  size_t MemoryUsage() const { return table_.capacity() * sizeof(uint32_t); }
+
+ private:
+  std::vector<uint32_t> table_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_MAGLEV_TABLE_H
@@ -28,7 +28,6 @@
 #include <vector>
 
 #include "absl/base/attributes.h"
-#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
@@ -49,12 +48,13 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/gprpp/work_serializer.h"
-#include "src/core/lib/gprpp/xxhash_inline.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -66,6 +66,8 @@
 #include "src/core/load_balancing/lb_policy_factory.h"
 #include "src/core/load_balancing/lb_policy_registry.h"
 #include "src/core/load_balancing/pick_first/pick_first.h"
+#include "src/core/load_balancing/ring_hash/ketama_ring.h"
+#include "src/core/load_balancing/ring_hash/maglev_table.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/json/json.h"
 
@@ -83,6 +85,8 @@ const JsonLoaderInterface* RingHashConfig::JsonLoader(const JsonArgs&) {
       JsonObjectLoader<RingHashConfig>()
           .OptionalField("minRingSize", &RingHashConfig::min_ring_size)
           .OptionalField("maxRingSize", &RingHashConfig::max_ring_size)
+          .OptionalField("maglevTableSize",
+                         &RingHashConfig::maglev_table_size)
           .Finish();
   return loader;
 }
@@ -106,6 +110,15 @@ void RingHashConfig::JsonPostLoad(const Json&, const JsonArgs&,
   if (min_ring_size > max_ring_size) {
     errors->AddError("max_ring_size cannot be smaller than min_ring_size");
   }
+  {
+    ValidationErrors::ScopedField field(errors, ".maglevTableSize");
+    if (!errors->FieldHasErrors() && maglev_table_size != 0 &&
+        (maglev_table_size > MaglevTable::kMaxTableSize ||
+         !MaglevTable::IsPrime(maglev_table_size))) {
+      errors->AddError(absl::StrCat("must be a prime number no larger than ",
+                                    MaglevTable::kMaxTableSize));
+    }
+  }
 }
 
 namespace {
@@ -114,15 +127,20 @@ constexpr absl::string_view kRingHash = "ring_hash_experimental";
 
 class RingHashLbConfig final : public LoadBalancingPolicy::Config {
  public:
-  RingHashLbConfig(size_t min_ring_size, size_t max_ring_size)
-      : min_ring_size_(min_ring_size), max_ring_size_(max_ring_size) {}
+  RingHashLbConfig(size_t min_ring_size, size_t max_ring_size,
+                   size_t maglev_table_size)
+      : min_ring_size_(min_ring_size),
+        max_ring_size_(max_ring_size),
+        maglev_table_size_(maglev_table_size) {}
   absl::string_view name() const override { return kRingHash; }
   size_t min_ring_size() const { return min_ring_size_; }
   size_t max_ring_size() const { return max_ring_size_; }
+  size_t maglev_table_size() const { return maglev_table_size_; }
 
  private:
   size_t min_ring_size_;
   size_t max_ring_size_;
+  size_t maglev_table_size_;
 };
 
 //
@@ -141,20 +159,70 @@ class RingHash final : public LoadBalancingPolicy {
   void ResetBackoffLocked() override;
 
  private:
-  // A ring computed based on a config and address list.
+  friend size_t grpc_core::RingHashTestOnlySharedRingCount();
+
+  // A ring computed based on a config and address list.  Either a ketama
+  // ring or, if the config sets a Maglev table size, a Maglev lookup table,
+  // whose slots are its positions.
+  //
+  // Rings are immutable, and policies whose configs and address lists give
+  // the same ring share a single copy.
   class Ring final : public RefCounted<Ring> {
    public:
-    struct RingEntry {
-      uint64_t hash;
-      size_t endpoint_index;  // Index into RingHash::endpoints_.
-    };
+    // Returns the ring for the config and ring_hash's endpoints.  previous,
+    // if non-null, is the ring for ring_hash's previous endpoints; the
+    // hashes of endpoints that did not change are copied from it rather
+    // than computed again.
+    static RefCountedPtr<Ring> Get(RingHash* ring_hash,
+                                   RingHashLbConfig* config,
+                                   const Ring* previous);
+
+    // The number of rings shared between policies.  For tests.
+    static size_t TestOnlySharedCount();
+
+    ~Ring() override;
+
+    // The number of positions on the ring.
+    size_t size() const {
+      return maglev_table_.has_value() ? maglev_table_->size()
+                                       : ketama_ring_->size();
+    }
 
-    Ring(RingHash* ring_hash, RingHashLbConfig* config);
+    // Returns the position of the first endpoint to try for request_hash.
+    size_t FindPosition(uint64_t request_hash) const {
+      return maglev_table_.has_value()
+                 ? maglev_table_->Slot(request_hash)
+                 : ketama_ring_->FindPosition(request_hash);
+    }
 
-    const std::vector<RingEntry>& ring() const { return ring_; }
+    // Returns the index into RingHash::endpoints_ of the endpoint at
+    // position.
+    size_t EndpointIndex(size_t position) const {
+      return maglev_table_.has_value()
+                 ? maglev_table_->EndpointIndex(position)
+                 : ketama_ring_->EndpointIndex(position);
+    }
 
    private:
-    std::vector<RingEntry> ring_;
+    explicit Ring(std::string key) : key_(std::move(key)) {}
+
+    static void AppendEndpointToKey(absl::string_view address, uint64_t value,
+                                    std::string* key);
+    // Returns the shared ring for key, if there is one.
+    static RefCountedPtr<Ring> FindShared(absl::string_view key);
+    // Makes ring the shared ring for its key, unless another one was
+    // shared since FindShared(), in which case that one is returned.
+    static RefCountedPtr<Ring> Share(RefCountedPtr<Ring> ring);
+
+    // The rings in use, by key.  The keys are owned by the rings.
+    static NoDestruct<Mutex> shared_rings_mu_;
+    static NoDestruct<std::map<absl::string_view, Ring*>> shared_rings_
+        ABSL_GUARDED_BY(shared_rings_mu_);
+
+    // Identifies the config and endpoints the ring was built from.
+    const std::string key_;
+    absl::optional<KetamaRing> ketama_ring_;
+    absl::optional<MaglevTable> maglev_table_;
   };
 
   // State for a particular endpoint.  Delegates to a pick_first child policy.
@@ -304,40 +372,13 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   if (hash_attribute == nullptr) {
     return PickResult::Fail(absl::InternalError("hash attribute not present"));
   }
-  uint64_t request_hash = hash_attribute->request_hash();
-  const auto& ring = ring_->ring();
+  const Ring& ring = *ring_;
   // Find the index in the ring to use for this RPC.
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and index. Do not change them!
-  int64_t lowp = 0;
-  int64_t highp = ring.size();
-  int64_t index = 0;
-  while (true) {
-    index = (lowp + highp) / 2;
-    if (index == static_cast<int64_t>(ring.size())) {
-      index = 0;
-      break;
-    }
-    uint64_t midval = ring[index].hash;
-    uint64_t midval1 = index == 0 ? 0 : ring[index - 1].hash;
-    if (request_hash <= midval && request_hash > midval1) {
-      break;
-    }
-    if (midval < request_hash) {
-      lowp = index + 1;
-    } else {
-      highp = index - 1;
-    }
-    if (lowp > highp) {
-      index = 0;
-      break;
-    }
-  }
+  const size_t index = ring.FindPosition(hash_attribute->request_hash());
   // Find the first endpoint we can use from the selected index.
   for (size_t i = 0; i < ring.size(); ++i) {
-    const auto& entry = ring[(index + i) % ring.size()];
-    const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    const auto& endpoint_info =
+        endpoints_[ring.EndpointIndex((index + i) % ring.size())];
     switch (endpoint_info.state) {
       case GRPC_CHANNEL_READY:
         return endpoint_info.picker->Pick(args);
@@ -354,14 +395,25 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   }
   return PickResult::Fail(absl::UnavailableError(absl::StrCat(
       "ring hash cannot find a connected endpoint; first failure: ",
-      endpoints_[ring[index].endpoint_index].status.message())));
+      endpoints_[ring.EndpointIndex(index)].status.message())));
 }
 
 //
 // RingHash::Ring
 //
 
-RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
+NoDestruct<Mutex> RingHash::Ring::shared_rings_mu_;
+NoDestruct<std::map<absl::string_view, RingHash::Ring*>>
+    RingHash::Ring::shared_rings_;
+
+size_t RingHash::Ring::TestOnlySharedCount() {
+  MutexLock lock(&*shared_rings_mu_);
+  return shared_rings_->size();
+}
+
+RefCountedPtr<RingHash::Ring> RingHash::Ring::Get(RingHash* ring_hash,
+                                                  RingHashLbConfig* config,
+                                                  const Ring* previous) {
   // Store the weights while finding the sum.
   struct EndpointWeight {
     std::string address;  // Key by endpoint's first address.
@@ -387,6 +439,24 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
     sum += endpoint_weight.weight;
     endpoint_weights.push_back(std::move(endpoint_weight));
   }
+  // The Maglev table takes the weights as they are, and its size does not
+  // depend on them.
+  if (config->maglev_table_size() != 0) {
+    std::string key = absl::StrCat("maglev ", config->maglev_table_size());
+    std::vector<MaglevTable::Endpoint> maglev_endpoints;
+    maglev_endpoints.reserve(endpoint_weights.size());
+    for (auto& endpoint_weight : endpoint_weights) {
+      AppendEndpointToKey(endpoint_weight.address, endpoint_weight.weight,
+                          &key);
+      maglev_endpoints.push_back(
+          {std::move(endpoint_weight.address), endpoint_weight.weight});
+    }
+    RefCountedPtr<Ring> ring = FindShared(key);
+    if (ring != nullptr) return ring;
+    ring.reset(new Ring(std::move(key)));
+    ring->maglev_table_.emplace(maglev_endpoints, config->maglev_table_size());
+    return Share(std::move(ring));
+  }
   // Calculating normalized weights and find min and max.
   double min_normalized_weight = 1.0;
   double max_normalized_weight = 0.0;
@@ -413,46 +483,74 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
   const double scale = std::min(
       std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
       static_cast<double>(max_ring_size));
-  // Reserve memory for the entire ring up front.
-  const uint64_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
-  // Populate the hash ring by walking through the (host, weight) pairs in
-  // normalized_host_weights, and generating (scale * weight) hashes for each
-  // host. Since these aren't necessarily whole numbers, we maintain running
-  // sums -- current_hashes and target_hashes -- which allows us to populate the
-  // ring in a mostly stable way.
-  absl::InlinedVector<char, 196> hash_key_buffer;
+  // Give each endpoint (scale * weight) hashes.  Since these aren't
+  // necessarily whole numbers, we maintain running sums -- current_hashes
+  // and target_hashes -- which allows us to populate the ring in a mostly
+  // stable way.
+  //
+  // The ring is determined by the addresses and the numbers of hashes, so
+  // those are all that identify it.
+  std::string key = "ring";
+  std::vector<KetamaRing::Endpoint> ketama_endpoints;
+  ketama_endpoints.reserve(endpoint_weights.size());
   double current_hashes = 0.0;
   double target_hashes = 0.0;
-  uint64_t min_hashes_per_host = ring_size;
-  uint64_t max_hashes_per_host = 0;
-  for (size_t i = 0; i < endpoints.size(); ++i) {
-    const std::string& address_string = endpoint_weights[i].address;
-    hash_key_buffer.assign(address_string.begin(), address_string.end());
-    hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
-    target_hashes += scale * endpoint_weights[i].normalized_weight;
+  for (auto& endpoint_weight : endpoint_weights) {
+    target_hashes += scale * endpoint_weight.normalized_weight;
     size_t count = 0;
     while (current_hashes < target_hashes) {
-      const std::string count_str = absl::StrCat(count);
-      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
-      absl::string_view hash_key(hash_key_buffer.data(),
-                                 hash_key_buffer.size());
-      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, i});
       ++count;
       ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
     }
-    min_hashes_per_host =
-        std::min(static_cast<uint64_t>(i), min_hashes_per_host);
-    max_hashes_per_host =
-        std::max(static_cast<uint64_t>(i), max_hashes_per_host);
+    AppendEndpointToKey(endpoint_weight.address, count, &key);
+    ketama_endpoints.push_back({std::move(endpoint_weight.address), count});
   }
-  std::sort(ring_.begin(), ring_.end(),
-            [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
-              return lhs.hash < rhs.hash;
-            });
+  RefCountedPtr<Ring> ring = FindShared(key);
+  if (ring != nullptr) return ring;
+  ring.reset(new Ring(std::move(key)));
+  ring->ketama_ring_.emplace(
+      std::move(ketama_endpoints),
+      previous != nullptr && previous->ketama_ring_.has_value()
+          ? &*previous->ketama_ring_
+          : nullptr);
+  return Share(std::move(ring));
+}
+
+RingHash::Ring::~Ring() {
+  MutexLock lock(&*shared_rings_mu_);
+  auto it = shared_rings_->find(key_);
+  if (it != shared_rings_->end() && it->second == this) {
+    shared_rings_->erase(it);
+  }
+}
+
+void RingHash::Ring::AppendEndpointToKey(absl::string_view address,
+                                         uint64_t value, std::string* key) {
+  // Addresses may contain any character, so prefix them with their length.
+  absl::StrAppend(key, ";", address.size(), ":", address, "/", value);
+}
+
+RefCountedPtr<RingHash::Ring> RingHash::Ring::FindShared(
+    absl::string_view key) {
+  MutexLock lock(&*shared_rings_mu_);
+  auto it = shared_rings_->find(key);
+  if (it == shared_rings_->end()) return nullptr;
+  // The ring may be in the middle of being destroyed.
+  return it->second->RefIfNonZero();
+}
+
+RefCountedPtr<RingHash::Ring> RingHash::Ring::Share(RefCountedPtr<Ring> ring) {
+  MutexLock lock(&*shared_rings_mu_);
+  auto it = shared_rings_->find(ring->key_);
+  if (it != shared_rings_->end()) {
+    // Another policy built the same ring in the meantime.  Our copy is
+    // unreffed after the lock is released.
+    auto existing = it->second->RefIfNonZero();
+    if (existing != nullptr) return existing;
+    shared_rings_->erase(it);
+  }
+  shared_rings_->emplace(ring->key_, ring.get());
+  return ring;
 }
 
 //
@@ -655,8 +753,8 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
   // Save channel args.
   args_ = std::move(args.args);
   // Build new ring.
-  ring_ = MakeRefCounted<Ring>(
-      this, static_cast<RingHashLbConfig*>(args.config.get()));
+  ring_ = Ring::Get(this, static_cast<RingHashLbConfig*>(args.config.get()),
+                    ring_.get());
   // Update endpoint map.
   std::map<EndpointAddressSet, OrphanablePtr<RingHashEndpoint>> endpoint_map;
   std::vector<std::string> errors;
@@ -859,12 +957,17 @@ class RingHashFactory final : public LoadBalancingPolicyFactory {
         json, JsonArgs(), "errors validating ring_hash LB policy config");
     if (!config.ok()) return config.status();
     return MakeRefCounted<RingHashLbConfig>(config->min_ring_size,
-                                            config->max_ring_size);
+                                            config->max_ring_size,
+                                            config->maglev_table_size);
   }
 };
 
 }  // namespace
 
+size_t RingHashTestOnlySharedRingCount() {
+  return RingHash::Ring::TestOnlySharedCount();
+}
+
 void RegisterRingHashLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
       std::make_unique<RingHashFactory>());
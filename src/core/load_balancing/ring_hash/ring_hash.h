@@ -17,6 +17,7 @@
 #ifndef GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_RING_HASH_H
 #define GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_RING_HASH_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <grpc/support/port_platform.h>
@@ -51,12 +52,18 @@ class RequestHashAttribute final
 struct RingHashConfig {
   uint64_t min_ring_size = 1024;
   uint64_t max_ring_size = 4096;
+  // If non-zero, picks use a Maglev lookup table of this many slots instead
+  // of the ring.  Must be prime.
+  uint64_t maglev_table_size = 0;
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
   void JsonPostLoad(const Json& json, const JsonArgs&,
                     ValidationErrors* errors);
 };
 
+// Returns the number of rings that ring_hash policies are sharing.  For tests.
+size_t RingHashTestOnlySharedRingCount();
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_RING_HASH_H
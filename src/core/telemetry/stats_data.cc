@@ -156,6 +156,10 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "busy_poll_spin_hits",
+        "busy_poll_spin_misses",
+        "adaptive_compression_compressed_messages",
+        "adaptive_compression_skipped_messages",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -199,6 +203,11 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of busy poll spins that found an event before their budget ran out",
+    "Number of busy poll spins that found no event and fell back to a blocking "
+    "poll",
+    "Number of messages adaptive compression chose to compress",
+    "Number of messages adaptive compression sent uncompressed",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -231,6 +240,10 @@ const absl::string_view
         "chaotic_good_tcp_read_offer_control",
         "chaotic_good_tcp_write_size_data",
         "chaotic_good_tcp_write_size_control",
+        "tcp_accept_batch_size",
+        "http2_hpack_warm_start_bytes_saved",
+        "http2_writes_coalesced",
+        "adaptive_compression_savings_percent",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
@@ -264,6 +277,14 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes offered to each syscall_read in the control channel",
     "Number of bytes offered to each syscall_write in the data channel",
     "Number of bytes offered to each syscall_write in the control channel",
+    "Number of connections accepted per readiness notification of a listening "
+    "socket",
+    "Number of header bytes a connection saved by indexing header pairs "
+    "learned from earlier connections to the same target",
+    "Number of write requests combined into each write held open by the http2 "
+    "write coalescing window",
+    "Share of the bytes, in percent, saved by each message compressed under "
+    "adaptive compression",
 };
 namespace {
 const int kStatsTable0[21] = {0,    1,    2,    4,     8,     15,    27,
@@ -491,7 +512,11 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      busy_poll_spin_hits{0},
+      busy_poll_spin_misses{0},
+      adaptive_compression_compressed_messages{0},
+      adaptive_compression_skipped_messages{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -584,6 +609,18 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kChaoticGoodTcpWriteSizeControl:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
                            chaotic_good_tcp_write_size_control.buckets()};
+    case Histogram::kTcpAcceptBatchSize:
+      return HistogramView{&Histogram_100_20::BucketFor, kStatsTable4, 20,
+                           tcp_accept_batch_size.buckets()};
+    case Histogram::kHttp2HpackWarmStartBytesSaved:
+      return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable2, 26,
+                           http2_hpack_warm_start_bytes_saved.buckets()};
+    case Histogram::kHttp2WritesCoalesced:
+      return HistogramView{&Histogram_100_20::BucketFor, kStatsTable4, 20,
+                           http2_writes_coalesced.buckets()};
+    case Histogram::kAdaptiveCompressionSavingsPercent:
+      return HistogramView{&Histogram_100_20::BucketFor, kStatsTable4, 20,
+                           adaptive_compression_savings_percent.buckets()};
   }
 }
 std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
@@ -651,6 +688,16 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->busy_poll_spin_hits +=
+        data.busy_poll_spin_hits.load(std::memory_order_relaxed);
+    result->busy_poll_spin_misses +=
+        data.busy_poll_spin_misses.load(std::memory_order_relaxed);
+    result->adaptive_compression_compressed_messages +=
+        data.adaptive_compression_compressed_messages.load(
+            std::memory_order_relaxed);
+    result->adaptive_compression_skipped_messages +=
+        data.adaptive_compression_skipped_messages.load(
+            std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
@@ -699,6 +746,12 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->chaotic_good_tcp_write_size_data);
     data.chaotic_good_tcp_write_size_control.Collect(
         &result->chaotic_good_tcp_write_size_control);
+    data.tcp_accept_batch_size.Collect(&result->tcp_accept_batch_size);
+    data.http2_hpack_warm_start_bytes_saved.Collect(
+        &result->http2_hpack_warm_start_bytes_saved);
+    data.http2_writes_coalesced.Collect(&result->http2_writes_coalesced);
+    data.adaptive_compression_savings_percent.Collect(
+        &result->adaptive_compression_savings_percent);
   }
   return result;
 }
@@ -750,6 +803,15 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->busy_poll_spin_hits = busy_poll_spin_hits - other.busy_poll_spin_hits;
+  result->busy_poll_spin_misses =
+      busy_poll_spin_misses - other.busy_poll_spin_misses;
+  result->adaptive_compression_compressed_messages =
+      adaptive_compression_compressed_messages -
+      other.adaptive_compression_compressed_messages;
+  result->adaptive_compression_skipped_messages =
+      adaptive_compression_skipped_messages -
+      other.adaptive_compression_skipped_messages;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -814,6 +876,16 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->chaotic_good_tcp_write_size_control =
       chaotic_good_tcp_write_size_control -
       other.chaotic_good_tcp_write_size_control;
+  result->tcp_accept_batch_size =
+      tcp_accept_batch_size - other.tcp_accept_batch_size;
+  result->http2_hpack_warm_start_bytes_saved =
+      http2_hpack_warm_start_bytes_saved -
+      other.http2_hpack_warm_start_bytes_saved;
+  result->http2_writes_coalesced =
+      http2_writes_coalesced - other.http2_writes_coalesced;
+  result->adaptive_compression_savings_percent =
+      adaptive_compression_savings_percent -
+      other.adaptive_compression_savings_percent;
   return result;
 }
 }  // namespace grpc_core
@@ -234,6 +234,10 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kBusyPollSpinHits,
+    kBusyPollSpinMisses,
+    kAdaptiveCompressionCompressedMessages,
+    kAdaptiveCompressionSkippedMessages,
     COUNT
   };
   enum class Histogram {
@@ -266,6 +270,10 @@ struct GlobalStats {
     kChaoticGoodTcpReadOfferControl,
     kChaoticGoodTcpWriteSizeData,
     kChaoticGoodTcpWriteSizeControl,
+    kTcpAcceptBatchSize,
+    kHttp2HpackWarmStartBytesSaved,
+    kHttp2WritesCoalesced,
+    kAdaptiveCompressionSavingsPercent,
     COUNT
   };
   GlobalStats();
@@ -311,6 +319,10 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t busy_poll_spin_hits;
+      uint64_t busy_poll_spin_misses;
+      uint64_t adaptive_compression_compressed_messages;
+      uint64_t adaptive_compression_skipped_messages;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -343,6 +355,10 @@ struct GlobalStats {
   Histogram_16777216_20 chaotic_good_tcp_read_offer_control;
   Histogram_16777216_20 chaotic_good_tcp_write_size_data;
   Histogram_16777216_20 chaotic_good_tcp_write_size_control;
+  Histogram_100_20 tcp_accept_batch_size;
+  Histogram_65536_26 http2_hpack_warm_start_bytes_saved;
+  Histogram_100_20 http2_writes_coalesced;
+  Histogram_100_20 adaptive_compression_savings_percent;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -465,6 +481,22 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementBusyPollSpinHits() {
+    data_.this_cpu().busy_poll_spin_hits.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  }
+  void IncrementBusyPollSpinMisses() {
+    data_.this_cpu().busy_poll_spin_misses.fetch_add(1,
+                                                     std::memory_order_relaxed);
+  }
+  void IncrementAdaptiveCompressionCompressedMessages() {
+    data_.this_cpu().adaptive_compression_compressed_messages.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementAdaptiveCompressionSkippedMessages() {
+    data_.this_cpu().adaptive_compression_skipped_messages.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -553,6 +585,18 @@ class GlobalStatsCollector {
   void IncrementChaoticGoodTcpWriteSizeControl(int value) {
     data_.this_cpu().chaotic_good_tcp_write_size_control.Increment(value);
   }
+  void IncrementTcpAcceptBatchSize(int value) {
+    data_.this_cpu().tcp_accept_batch_size.Increment(value);
+  }
+  void IncrementHttp2HpackWarmStartBytesSaved(int value) {
+    data_.this_cpu().http2_hpack_warm_start_bytes_saved.Increment(value);
+  }
+  void IncrementHttp2WritesCoalesced(int value) {
+    data_.this_cpu().http2_writes_coalesced.Increment(value);
+  }
+  void IncrementAdaptiveCompressionSavingsPercent(int value) {
+    data_.this_cpu().adaptive_compression_savings_percent.Increment(value);
+  }
 
  private:
   struct Data {
@@ -590,6 +634,10 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> busy_poll_spin_hits{0};
+    std::atomic<uint64_t> busy_poll_spin_misses{0};
+    std::atomic<uint64_t> adaptive_compression_compressed_messages{0};
+    std::atomic<uint64_t> adaptive_compression_skipped_messages{0};
     HistogramCollector_65536_26 call_initial_size;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
@@ -619,6 +667,10 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20 chaotic_good_tcp_read_offer_control;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_data;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_control;
+    HistogramCollector_100_20 tcp_accept_batch_size;
+    HistogramCollector_65536_26 http2_hpack_warm_start_bytes_saved;
+    HistogramCollector_100_20 http2_writes_coalesced;
+    HistogramCollector_100_20 adaptive_compression_savings_percent;
   };
   PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 };
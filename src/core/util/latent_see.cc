@@ -34,8 +34,11 @@ namespace latent_see {
 thread_local uint64_t Log::thread_id_ = Log::Get().next_thread_id_.fetch_add(1);
 thread_local Bin* Log::bin_ = nullptr;
 thread_local void* Log::bin_owner_ = nullptr;
+thread_local uint32_t Log::calls_since_sample_ = 0;
 std::atomic<uint64_t> Flow::next_flow_id_{1};
 std::atomic<uintptr_t> Log::free_bins_{0};
+std::atomic<bool> Log::enabled_{true};
+std::atomic<uint32_t> Log::call_sample_rate_{1};
 
 std::string Log::GenerateJson() {
   std::vector<RecordedEvent> events;
@@ -113,6 +113,35 @@ class Log {
 
   static Bin* CurrentThreadBin() { return bin_; }
 
+  // Detaches the current thread's bin so that nothing is recorded until the
+  // matching ResumeBin, which restores it.
+  static std::pair<Bin*, void*> SuspendBin() {
+    return {std::exchange(bin_, nullptr), std::exchange(bin_owner_, nullptr)};
+  }
+  static void ResumeBin(std::pair<Bin*, void*> saved) {
+    bin_ = saved.first;
+    bin_owner_ = saved.second;
+  }
+
+  // Recording can be switched on and off at runtime; parent scopes opened
+  // while it is off record nothing, and neither does anything inside them.
+  static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+  static void SetEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  // Calls are sampled one in every n; zero samples no calls.
+  static void SetCallSampleRate(uint32_t one_in_n) {
+    call_sample_rate_.store(one_in_n, std::memory_order_relaxed);
+  }
+  // Decides whether the call being created is recorded.
+  static bool SampleCall() {
+    if (!enabled()) return false;
+    const uint32_t n = call_sample_rate_.load(std::memory_order_relaxed);
+    if (n <= 1) return n == 1;
+    return ++calls_since_sample_ % n == 0;
+  }
+
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static Log& Get() {
     static Log* log = []() {
       atexit([] {
@@ -153,7 +182,10 @@ class Log {
   static thread_local uint64_t thread_id_;
   static thread_local Bin* bin_;
   static thread_local void* bin_owner_;
+  static thread_local uint32_t calls_since_sample_;
   static std::atomic<uintptr_t> free_bins_;
+  static std::atomic<bool> enabled_;
+  static std::atomic<uint32_t> call_sample_rate_;
   absl::AnyInvocable<void(absl::string_view)> stats_flusher_ = nullptr;
   struct Fragment {
     Fragment() : active(&primary){};
@@ -169,17 +201,34 @@ class Log {
 template <bool kParent>
 class Scope {
  public:
-  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit Scope(const Metadata* metadata)
+  // A parent scope with record == false suppresses recording for its
+  // duration, even if an enclosing scope is recording.
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit Scope(const Metadata* metadata,
+                                                      bool record = true)
       : metadata_(metadata) {
     bin_ = Log::CurrentThreadBin();
-    if (kParent && bin_ == nullptr) {
-      bin_descriptor_ = Log::StartBin(this);
-      bin_ = Log::ToBin(bin_descriptor_);
+    if (kParent) {
+      if (!record || !Log::enabled()) {
+        if (bin_ != nullptr) {
+          suspended_ = Log::SuspendBin();
+          bin_ = nullptr;
+        }
+        return;
+      }
+      if (bin_ == nullptr) {
+        bin_descriptor_ = Log::StartBin(this);
+        bin_ = Log::ToBin(bin_descriptor_);
+      }
     }
-    CHECK_NE(bin_, nullptr);
+    // Inner scopes record only within a recording parent scope.
+    if (bin_ == nullptr) return;
     bin_->Append(metadata_, EventType::kBegin, 0);
   }
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ~Scope() {
+    if (bin_ == nullptr) {
+      if (kParent && suspended_.first != nullptr) Log::ResumeBin(suspended_);
+      return;
+    }
     bin_->Append(metadata_, EventType::kEnd, 0);
     if (kParent) Log::EndBin(bin_descriptor_, this);
   }
@@ -191,6 +240,7 @@ class Scope {
   const Metadata* const metadata_;
   uintptr_t bin_descriptor_ = 0;
   Bin* bin_ = nullptr;
+  std::pair<Bin*, void*> suspended_{nullptr, nullptr};
 };
 
 using ParentScope = Scope<true>;
@@ -200,24 +250,17 @@ class Flow {
  public:
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION Flow() : metadata_(nullptr) {}
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit Flow(const Metadata* metadata)
-      : metadata_(metadata),
-        id_(next_flow_id_.fetch_add(1, std::memory_order_relaxed)) {
-    Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowStart, id_);
-  }
-  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ~Flow() {
-    if (metadata_ != nullptr) {
-      Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowEnd, id_);
-    }
+      : metadata_(nullptr) {
+    Begin(metadata);
   }
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ~Flow() { End(); }
 
   Flow(const Flow&) = delete;
   Flow& operator=(const Flow&) = delete;
   Flow(Flow&& other) noexcept
       : metadata_(std::exchange(other.metadata_, nullptr)), id_(other.id_) {}
   Flow& operator=(Flow&& other) noexcept {
-    if (metadata_ != nullptr) {
-      Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowEnd, id_);
-    }
+    End();
     metadata_ = std::exchange(other.metadata_, nullptr);
     id_ = other.id_;
     return *this;
@@ -228,16 +271,16 @@ class Flow {
   }
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void End() {
     if (metadata_ == nullptr) return;
-    Log::CurrentThreadBin()->Append(metadata_, EventType::kFlowEnd, id_);
+    auto* bin = Log::CurrentThreadBin();
+    if (bin != nullptr) bin->Append(metadata_, EventType::kFlowEnd, id_);
     metadata_ = nullptr;
   }
+  // Flows are only started while recording.
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION void Begin(const Metadata* metadata) {
+    End();
     auto* bin = Log::CurrentThreadBin();
-    if (metadata_ != nullptr) {
-      bin->Append(metadata_, EventType::kFlowEnd, id_);
-    }
+    if (bin == nullptr || metadata == nullptr) return;
     metadata_ = metadata;
-    if (metadata_ == nullptr) return;
     id_ = next_flow_id_.fetch_add(1, std::memory_order_relaxed);
     bin->Append(metadata_, EventType::kFlowStart, id_);
   }
@@ -249,8 +292,30 @@ class Flow {
 };
 
 GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline void Mark(const Metadata* md) {
-  Log::CurrentThreadBin()->Append(md, EventType::kMark, 0);
+  auto* bin = Log::CurrentThreadBin();
+  if (bin != nullptr) bin->Append(md, EventType::kMark, 0);
+}
+
+// Decides once, when a call is created, whether its work is recorded.
+class CallSample {
+ public:
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION bool sampled() const {
+    return sampled_;
+  }
+
+ private:
+  const bool sampled_ = Log::SampleCall();
+};
+
+// Runtime controls, available whether or not latent_see is compiled in.
+inline void SetEnabled(bool enabled) { Log::SetEnabled(enabled); }
+inline bool IsEnabled() { return Log::enabled(); }
+inline void SetCallSampleRate(uint32_t one_in_n) {
+  Log::SetCallSampleRate(one_in_n);
 }
+// Takes everything recorded since the last export as Chrome trace event JSON,
+// which chrome://tracing and Perfetto load directly.
+inline std::string ExportJson() { return Log::Get().GenerateJson(); }
 
 }  // namespace latent_see
 }  // namespace grpc_core
@@ -266,6 +331,11 @@ GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline void Mark(const Metadata* md) {
 #define GRPC_LATENT_SEE_PARENT_SCOPE(name)                       \
   grpc_core::latent_see::ParentScope latent_see_scope##__LINE__( \
       GRPC_LATENT_SEE_METADATA(name))
+// Parent scope that records only if cond holds (for example, only for sampled
+// calls), and otherwise stops any enclosing scope recording until it exits.
+#define GRPC_LATENT_SEE_PARENT_SCOPE_IF(cond, name)              \
+  grpc_core::latent_see::ParentScope latent_see_scope##__LINE__( \
+      GRPC_LATENT_SEE_METADATA(name), (cond))
 // Inner scope: logs a begin and end event. Lighter weight than parent scope,
 // but does not flush the thread state - so should only be enclosed by a parent
 // scope.
@@ -278,6 +348,9 @@ GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION inline void Mark(const Metadata* md) {
 #define GRPC_LATENT_SEE_MARK(name) \
   grpc_core::latent_see::Mark(GRPC_LATENT_SEE_METADATA(name))
 #else  // !def(GRPC_ENABLE_LATENT_SEE)
+#include <cstdint>
+#include <string>
+
 namespace grpc_core {
 namespace latent_see {
 struct Metadata {};
@@ -292,12 +365,22 @@ struct ParentScope {
 struct InnerScope {
   explicit InnerScope(Metadata*) {}
 };
+struct CallSample {
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION bool sampled() const { return false; }
+};
+inline void SetEnabled(bool) {}
+inline bool IsEnabled() { return false; }
+inline void SetCallSampleRate(uint32_t) {}
+inline std::string ExportJson() { return "[]"; }
 }  // namespace latent_see
 }  // namespace grpc_core
 #define GRPC_LATENT_SEE_METADATA(name) nullptr
 #define GRPC_LATENT_SEE_PARENT_SCOPE(name) \
   do {                                     \
   } while (0)
+#define GRPC_LATENT_SEE_PARENT_SCOPE_IF(cond, name) \
+  do {                                             \
+  } while (0)
 #define GRPC_LATENT_SEE_INNER_SCOPE(name) \
   do {                                    \
   } while (0)
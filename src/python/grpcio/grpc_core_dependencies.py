@@ -46,6 +46,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/http/client/http_client_filter.cc',
     'src/core/ext/filters/http/client_authority_filter.cc',
     'src/core/ext/filters/http/http_filters_plugin.cc',
+    'src/core/ext/filters/http/message_compress/adaptive_compression.cc',
     'src/core/ext/filters/http/message_compress/compression_filter.cc',
     'src/core/ext/filters/http/server/http_server_filter.cc',
     'src/core/ext/filters/message_size/message_size_filter.cc',
@@ -60,6 +61,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/bin_encoder.cc',
     'src/core/ext/transport/chttp2/transport/chttp2_transport.cc',
     'src/core/ext/transport/chttp2/transport/decode_huff.cc',
+    'src/core/ext/transport/chttp2/transport/decode_huff_multisym.cc',
     'src/core/ext/transport/chttp2/transport/flow_control.cc',
     'src/core/ext/transport/chttp2/transport/frame.cc',
     'src/core/ext/transport/chttp2/transport/frame_data.cc',
@@ -442,7 +444,9 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/default_event_engine_factory.cc',
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/forkable.cc',
+    'src/core/lib/event_engine/posix_engine/busy_poll.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -455,6 +459,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
+    'src/core/lib/event_engine/posix_engine/timing_wheel.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
@@ -467,6 +472,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/thread_local.cc',
     'src/core/lib/event_engine/thread_pool/thread_count.cc',
+    'src/core/lib/event_engine/thread_pool/numa_topology.cc',
     'src/core/lib/event_engine/thread_pool/thread_pool_factory.cc',
     'src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc',
     'src/core/lib/event_engine/thready_event_engine/thready_event_engine.cc',
@@ -660,6 +666,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/security/transport/client_auth_filter.cc',
     'src/core/lib/security/transport/server_auth_filter.cc',
     'src/core/lib/security/util/json_util.cc',
+    'src/core/lib/slice/interned_slice.cc',
     'src/core/lib/slice/percent_encoding.cc',
     'src/core/lib/slice/slice.cc',
     'src/core/lib/slice/slice_buffer.cc',
@@ -722,6 +729,8 @@ CORE_SOURCE_FILES = [
     'src/core/load_balancing/outlier_detection/outlier_detection.cc',
     'src/core/load_balancing/pick_first/pick_first.cc',
     'src/core/load_balancing/priority/priority.cc',
+    'src/core/load_balancing/ring_hash/ketama_ring.cc',
+    'src/core/load_balancing/ring_hash/maglev_table.cc',
     'src/core/load_balancing/ring_hash/ring_hash.cc',
     'src/core/load_balancing/rls/rls.cc',
     'src/core/load_balancing/round_robin/round_robin.cc',
@@ -20,6 +20,8 @@
 
 #include <string.h>
 
+#include <utility>
+
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "gtest/gtest.h"
@@ -89,6 +91,49 @@ TEST(ChannelArgsTest, RemoveAllKeysWithPrefix) {
   EXPECT_EQ(modified.GetInt("bar"), 4);
 }
 
+TEST(ChannelArgsTest, HashIgnoresInsertionOrder) {
+  ChannelArgs a = ChannelArgs().Set("foo", 1).Set("bar", "baz");
+  ChannelArgs b = ChannelArgs().Set("bar", "baz").Set("foo", 1);
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(a.hash(), b.hash());
+  // Overwriting and removing keep the hash in step with the contents.
+  ChannelArgs c = a.Set("foo", 2).Set("qux", 3).Remove("qux").Set("foo", 1);
+  EXPECT_EQ(c, a);
+  EXPECT_EQ(c.hash(), a.hash());
+  EXPECT_NE(a.Set("foo", 2).hash(), a.hash());
+  ChannelArgs u = ChannelArgs().Set("foo", 5).UnionWith(b);
+  EXPECT_EQ(u.hash(), ChannelArgs().Set("foo", 5).Set("bar", "baz").hash());
+  EXPECT_EQ(a.RemoveAllKeysWithPrefix("ba").hash(),
+            ChannelArgs().Set("foo", 1).hash());
+  ChannelArgs moved = std::move(c);
+  EXPECT_EQ(moved.hash(), a.hash());
+}
+
+TEST(ChannelArgsTest, WellKnownArgs) {
+  constexpr WellKnownChannelArg kKeepaliveTime(GRPC_ARG_KEEPALIVE_TIME_MS);
+  static_assert(kKeepaliveTime.id() >= 0, "should be registered");
+  constexpr WellKnownChannelArg kUnregistered("grpc.not_well_known");
+  static_assert(kUnregistered.id() == -1, "should not be registered");
+  EXPECT_EQ(WellKnownChannelArg::IdOf(GRPC_ARG_KEEPALIVE_TIME_MS),
+            kKeepaliveTime.id());
+
+  ChannelArgs args;
+  EXPECT_EQ(args.GetInt(kKeepaliveTime), absl::nullopt);
+  EXPECT_FALSE(args.Contains(kKeepaliveTime));
+  args = args.Set(GRPC_ARG_KEEPALIVE_TIME_MS, 1000)
+             .Set("grpc.not_well_known", "x");
+  EXPECT_EQ(args.GetInt(kKeepaliveTime), 1000);
+  EXPECT_TRUE(args.Contains(kKeepaliveTime));
+  EXPECT_EQ(args.GetString(kUnregistered), "x");
+  args = args.Remove(GRPC_ARG_KEEPALIVE_TIME_MS);
+  EXPECT_EQ(args.GetInt(kKeepaliveTime), absl::nullopt);
+  EXPECT_EQ(ChannelArgs()
+                .Set(GRPC_ARG_KEEPALIVE_TIME_MS, 7)
+                .RemoveAllKeysWithPrefix("grpc.keepalive")
+                .GetInt(kKeepaliveTime),
+            absl::nullopt);
+}
+
 TEST(ChannelArgsTest, StoreRefCountedPtr) {
   struct Test : public RefCounted<Test> {
     explicit Test(int n) : n(n) {}
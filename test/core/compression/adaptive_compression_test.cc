@@ -0,0 +1,146 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/http/message_compress/adaptive_compression.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include <grpc/impl/compression_types.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_core {
+
+namespace {
+
+using Method = AdaptiveCompressionPolicy::Method;
+
+uint64_t CompressedMessages() {
+  return global_stats().Collect()->adaptive_compression_compressed_messages;
+}
+
+uint64_t SkippedMessages() {
+  return global_stats().Collect()->adaptive_compression_skipped_messages;
+}
+
+// Feeds 'method' messages of 1000 bytes that compress to 'compressed_size'
+// bytes in 'elapsed_us' microseconds, until it has seen 'count' of them.
+void Feed(Method* method, int count, size_t compressed_size,
+          int64_t elapsed_us) {
+  for (int i = 0; i < count; i++) {
+    if (method->ShouldCompress(1000)) {
+      method->Record(1000, compressed_size,
+                     gpr_time_from_micros(elapsed_us, GPR_TIMESPAN));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(AdaptiveCompressionTest, OptionsFromChannelArgs) {
+  auto options = AdaptiveCompressionPolicy::Options::FromChannelArgs(
+      ChannelArgs()
+          .Set(GRPC_COMPRESSION_CHANNEL_ADAPTIVE_MIN_SAVINGS_PERCENT, 150)
+          .Set(GRPC_COMPRESSION_CHANNEL_ADAPTIVE_MIN_BYTES_SAVED_PER_MS, 100)
+          .Set(GRPC_COMPRESSION_CHANNEL_ADAPTIVE_MIN_MESSAGE_SIZE, -1));
+  EXPECT_EQ(options.min_savings_percent, 100);
+  EXPECT_EQ(options.min_bytes_saved_per_ms, 100);
+  EXPECT_EQ(options.min_message_size, 0u);
+  auto defaults =
+      AdaptiveCompressionPolicy::Options::FromChannelArgs(ChannelArgs());
+  EXPECT_EQ(defaults.min_savings_percent, 10);
+  EXPECT_EQ(defaults.min_bytes_saved_per_ms, 4096);
+  EXPECT_EQ(defaults.min_message_size, 128u);
+}
+
+TEST(AdaptiveCompressionTest, SkipsSmallMessages) {
+  AdaptiveCompressionPolicy policy({});
+  Method* method = policy.GetMethod("/foo.Bar/Baz");
+  const uint64_t skipped = SkippedMessages();
+  EXPECT_FALSE(method->ShouldCompress(127));
+  EXPECT_TRUE(method->ShouldCompress(128));
+  EXPECT_EQ(SkippedMessages(), skipped + 1);
+}
+
+TEST(AdaptiveCompressionTest, KeepsCompressingWhenItPays) {
+  AdaptiveCompressionPolicy policy({});
+  Method* method = policy.GetMethod("/foo.Bar/Baz");
+  // 800 bytes saved in 10us is 80000 bytes per ms.
+  Feed(method, 100, 200, 10);
+  EXPECT_TRUE(method->compressing());
+}
+
+TEST(AdaptiveCompressionTest, StopsWhenRatioIsPoor) {
+  AdaptiveCompressionPolicy policy({});
+  Method* method = policy.GetMethod("/foo.Bar/Baz");
+  Feed(method, 1, 980, 1);
+  EXPECT_FALSE(method->compressing());
+  const uint64_t compressed = CompressedMessages();
+  const uint64_t skipped = SkippedMessages();
+  Feed(method, AdaptiveCompressionPolicy::kProbeInterval, 980, 1);
+  // Only the probe is compressed.
+  EXPECT_EQ(CompressedMessages(), compressed + 1);
+  EXPECT_EQ(SkippedMessages(),
+            skipped + AdaptiveCompressionPolicy::kProbeInterval - 1);
+}
+
+TEST(AdaptiveCompressionTest, StopsWhenTooSlow) {
+  AdaptiveCompressionPolicy policy({});
+  Method* method = policy.GetMethod("/foo.Bar/Baz");
+  // 500 bytes saved in 1ms is below the default 4096 bytes per ms.
+  Feed(method, 1, 500, 1000);
+  EXPECT_FALSE(method->compressing());
+}
+
+TEST(AdaptiveCompressionTest, ProbesResumeCompression) {
+  AdaptiveCompressionPolicy policy({});
+  Method* method = policy.GetMethod("/foo.Bar/Baz");
+  Feed(method, 1, 1000, 10);
+  EXPECT_FALSE(method->compressing());
+  Feed(method, 100 * AdaptiveCompressionPolicy::kProbeInterval, 100, 10);
+  EXPECT_TRUE(method->compressing());
+}
+
+TEST(AdaptiveCompressionTest, MethodsAreTrackedSeparately) {
+  AdaptiveCompressionPolicy policy({});
+  Method* foo = policy.GetMethod("/foo.Bar/Foo");
+  EXPECT_EQ(policy.GetMethod("/foo.Bar/Foo"), foo);
+  Method* baz = policy.GetMethod("/foo.Bar/Baz");
+  EXPECT_NE(foo, baz);
+  Feed(foo, 1, 1000, 10);
+  EXPECT_FALSE(foo->compressing());
+  EXPECT_TRUE(baz->compressing());
+}
+
+TEST(AdaptiveCompressionTest, MethodTableIsBounded) {
+  AdaptiveCompressionPolicy policy({});
+  for (size_t i = 0; i < AdaptiveCompressionPolicy::kMaxMethods; i++) {
+    policy.GetMethod(std::to_string(i));
+  }
+  Method* overflow = policy.GetMethod("/foo.Bar/Foo");
+  EXPECT_EQ(policy.GetMethod("/foo.Bar/Baz"), overflow);
+  EXPECT_NE(policy.GetMethod("0"), overflow);
+}
+
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -23,14 +23,20 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "absl/log/log.h"
 #include "gtest/gtest.h"
 
 #include <grpc/compression.h>
+#include <grpc/event_engine/internal/memory_allocator_impl.h>
+#include <grpc/event_engine/memory_request.h>
 #include <grpc/slice_buffer.h>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/slice_splitter.h"
 #include "test/core/test_util/test_config.h"
@@ -302,6 +308,115 @@ TEST(MessageCompressTest, BadDecompressionAlgorithm) {
   grpc_slice_buffer_destroy(&output);
 }
 
+TEST(MessageCompressTest, StreamCompression) {
+  for (grpc_compression_algorithm algorithm :
+       {GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_GZIP}) {
+    auto compressor = grpc_core::MessageStreamCompressor::Create(algorithm);
+    auto decompressor = grpc_core::MessageStreamDecompressor::Create(algorithm);
+    ASSERT_NE(compressor, nullptr);
+    ASSERT_NE(decompressor, nullptr);
+    const std::string message(
+        "{\"host\":\"server-1.example.com\",\"metric\":\"cpu_usage\"}");
+    size_t first_size = 0;
+    for (int i = 0; i < 3; i++) {
+      grpc_slice_buffer input;
+      grpc_slice_buffer compressed;
+      grpc_slice_buffer output;
+      grpc_slice_buffer_init(&input);
+      grpc_slice_buffer_init(&compressed);
+      grpc_slice_buffer_init(&output);
+      grpc_slice_buffer_add(&input, grpc_slice_from_copied_buffer(
+                                        message.data(), message.size()));
+      ASSERT_TRUE(compressor->Compress(&input, &compressed));
+      if (i == 0) {
+        first_size = compressed.length;
+      } else {
+        // Repeats refer back to the first message.
+        EXPECT_LT(compressed.length, first_size / 2);
+      }
+      ASSERT_TRUE(decompressor->Decompress(&compressed, &output));
+      grpc_slice final = grpc_slice_merge(output.slices, output.count);
+      EXPECT_EQ(grpc_core::StringViewFromSlice(final), message);
+      grpc_slice_unref(final);
+      grpc_slice_buffer_destroy(&input);
+      grpc_slice_buffer_destroy(&compressed);
+      grpc_slice_buffer_destroy(&output);
+    }
+  }
+  EXPECT_EQ(grpc_core::MessageStreamCompressor::Create(GRPC_COMPRESS_NONE),
+            nullptr);
+}
+
+// Keeps count of the bytes reserved through it.
+class CountingAllocatorImpl final
+    : public grpc_event_engine::experimental::internal::MemoryAllocatorImpl {
+ public:
+  size_t Reserve(grpc_core::MemoryRequest request) override {
+    used_ += request.min();
+    return request.min();
+  }
+  grpc_slice MakeSlice(grpc_core::MemoryRequest) override { abort(); }
+  void Release(size_t n) override {
+    ASSERT_GE(used_, n);
+    used_ -= n;
+  }
+  void Shutdown() override {}
+
+  size_t used() const { return used_; }
+
+ private:
+  size_t used_ = 0;
+};
+
+TEST(MessageCompressTest, ZlibStreamPool) {
+  auto counter = std::make_shared<CountingAllocatorImpl>();
+  {
+    grpc_core::ZlibStreamPool pool((grpc_core::MemoryAllocator(counter)));
+    const std::string message(4096, 'a');
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&input, grpc_slice_from_copied_buffer(
+                                      message.data(), message.size()));
+    ASSERT_EQ(grpc_msg_compress(GRPC_COMPRESS_GZIP, &input, &compressed,
+                                &pool),
+              1);
+    // The deflate state is charged, and kept for the next message.
+    EXPECT_GE(counter->used(), 256 * 1024);
+    EXPECT_EQ(pool.TestOnlyIdleStreams(), 1);
+    const size_t used = counter->used();
+    grpc_slice_buffer_reset_and_unref(&compressed);
+    ASSERT_EQ(grpc_msg_compress(GRPC_COMPRESS_GZIP, &input, &compressed,
+                                &pool),
+              1);
+    EXPECT_EQ(counter->used(), used);
+    ASSERT_EQ(grpc_msg_decompress(GRPC_COMPRESS_GZIP, &compressed, &output,
+                                  &pool),
+              1);
+    EXPECT_EQ(output.length, message.size());
+    EXPECT_EQ(pool.TestOnlyIdleStreams(), 2);
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+    // Streams of calls come from the pool too, but only a few are kept.
+    std::vector<std::unique_ptr<grpc_core::MessageStreamCompressor>> streams;
+    for (size_t i = 0; i < grpc_core::ZlibStreamPool::kMaxIdleStreams + 2;
+         i++) {
+      streams.push_back(grpc_core::MessageStreamCompressor::Create(
+          GRPC_COMPRESS_GZIP, &pool));
+      ASSERT_NE(streams.back(), nullptr);
+    }
+    EXPECT_EQ(pool.TestOnlyIdleStreams(), 1);
+    streams.clear();
+    EXPECT_EQ(pool.TestOnlyIdleStreams(),
+              grpc_core::ZlibStreamPool::kMaxIdleStreams + 1);
+  }
+  EXPECT_EQ(counter->used(), 0);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -22,6 +22,7 @@
 #include <string>
 #include <utility>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
 
@@ -31,8 +32,11 @@
 #include <grpc/status.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/bitset.h"
 #include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/surface/call_test_only.h"
+#include "src/core/lib/transport/message.h"
 #include "test/core/end2end/end2end_tests.h"
 
 namespace grpc_core {
@@ -75,6 +79,18 @@ class TestConfigurator {
     return *this;
   }
 
+  TestConfigurator& EnableStreamingAtClient() {
+    client_args_ =
+        client_args_.Set(GRPC_COMPRESSION_CHANNEL_ENABLE_STREAMING, true);
+    return *this;
+  }
+
+  TestConfigurator& EnableStreamingAtServer() {
+    server_args_ =
+        server_args_.Set(GRPC_COMPRESSION_CHANNEL_ENABLE_STREAMING, true);
+    return *this;
+  }
+
   TestConfigurator& ExpectedAlgorithmFromClient(
       grpc_compression_algorithm algorithm) {
     expected_algorithm_from_client_ = algorithm;
@@ -225,6 +241,47 @@ class TestConfigurator {
     EXPECT_FALSE(client_close.was_cancelled());
   }
 
+  // The server sends messages too short for gzip to make smaller, so they
+  // only arrive compressed if the call was stream compressed.
+  void StreamCompression(bool expect_stream_compressed) {
+    Init();
+    auto c =
+        test_.NewClientCall("/foo").Timeout(Duration::Seconds(30)).Create();
+    IncomingStatusOnClient server_status;
+    IncomingMetadata server_initial_metadata;
+    c.NewBatch(1)
+        .SendInitialMetadata({})
+        .SendCloseFromClient()
+        .RecvInitialMetadata(server_initial_metadata)
+        .RecvStatusOnClient(server_status);
+    auto s = test_.RequestCall(100);
+    test_.Expect(100, true);
+    test_.Step();
+    IncomingCloseOnServer client_close;
+    s.NewBatch(101).SendInitialMetadata({}).RecvCloseOnServer(client_close);
+    for (int i = 0; i < 3; i++) {
+      const std::string payload = absl::StrCat("message ", i);
+      s.NewBatch(102).SendMessage(payload);
+      IncomingMessage server_message;
+      c.NewBatch(2).RecvMessage(server_message);
+      test_.Expect(102, true);
+      test_.Expect(2, true);
+      test_.Step();
+      EXPECT_EQ(server_message.payload(), payload);
+      EXPECT_EQ((grpc_call_test_only_get_message_flags(c.c_call()) &
+                 GRPC_WRITE_INTERNAL_TEST_ONLY_WAS_COMPRESSED) != 0,
+                expect_stream_compressed);
+    }
+    s.NewBatch(103).SendStatusFromServer(GRPC_STATUS_OK, "xyz", {});
+    test_.Expect(1, true);
+    test_.Expect(101, true);
+    test_.Expect(103, true);
+    test_.Step();
+    EXPECT_EQ(server_status.status(), GRPC_STATUS_OK);
+    EXPECT_EQ(server_status.message(), "xyz");
+    EXPECT_FALSE(client_close.was_cancelled());
+  }
+
   void RequestWithServerLevel(grpc_compression_level server_compression_level) {
     Init();
     auto c = test_.NewClientCall("/foo").Timeout(Duration::Minutes(1)).Create();
@@ -435,5 +492,34 @@ CORE_END2END_TEST(
       .RequestWithPayload(0, {{"grpc-internal-encoding-request", "identity"}});
 }
 
+CORE_END2END_TEST(Http2SingleHopTest, StreamCompressionAccepted) {
+  TestConfigurator(*this)
+      .ServerDefaultAlgorithm(GRPC_COMPRESS_GZIP)
+      .EnableStreamingAtClient()
+      .EnableStreamingAtServer()
+      .StreamCompression(IsStreamCompressionEnabled());
+}
+
+CORE_END2END_TEST(Http2SingleHopTest, StreamCompressionNotAcceptedByServer) {
+  TestConfigurator(*this)
+      .ServerDefaultAlgorithm(GRPC_COMPRESS_GZIP)
+      .EnableStreamingAtClient()
+      .StreamCompression(false);
+}
+
+CORE_END2END_TEST(Http2SingleHopTest, StreamCompressionNotOfferedByClient) {
+  TestConfigurator(*this)
+      .ServerDefaultAlgorithm(GRPC_COMPRESS_GZIP)
+      .EnableStreamingAtServer()
+      .StreamCompression(false);
+}
+
+CORE_END2END_TEST(Http2SingleHopTest, StreamCompressionWithoutAlgorithm) {
+  TestConfigurator(*this)
+      .EnableStreamingAtClient()
+      .EnableStreamingAtServer()
+      .StreamCompression(false);
+}
+
 }  // namespace
 }  // namespace grpc_core
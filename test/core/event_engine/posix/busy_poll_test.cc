@@ -0,0 +1,115 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+using Duration = BusyPollBudget::Duration;
+
+constexpr Duration kMax = std::chrono::microseconds(64);
+
+uint64_t SpinHits() {
+  return grpc_core::global_stats().Collect()->busy_poll_spin_hits;
+}
+
+uint64_t SpinMisses() {
+  return grpc_core::global_stats().Collect()->busy_poll_spin_misses;
+}
+
+}  // namespace
+
+TEST(BusyPollBudgetTest, ZeroMaxDisables) {
+  BusyPollBudget budget(Duration::zero());
+  EXPECT_FALSE(budget.enabled());
+  EXPECT_TRUE(BusyPollBudget(kMax).enabled());
+}
+
+TEST(BusyPollBudgetTest, ShrinksOnMissesAndGrowsOnHits) {
+  BusyPollBudget budget(kMax);
+  EXPECT_EQ(budget.budget(), kMax);
+  for (int i = 0; i < 20; i++) budget.OnSpinMiss();
+  EXPECT_EQ(budget.budget(), kMax / BusyPollBudget::kMinFraction);
+  budget.OnSpinHit();
+  EXPECT_EQ(budget.budget(), 2 * kMax / BusyPollBudget::kMinFraction);
+  for (int i = 0; i < 20; i++) budget.OnSpinHit();
+  EXPECT_EQ(budget.budget(), kMax);
+}
+
+TEST(BusyPollBudgetTest, SpinReturnsFirstEvent) {
+  BusyPollBudget budget(std::chrono::seconds(10));
+  const uint64_t hits = SpinHits();
+  int polls = 0;
+  EXPECT_EQ(budget.Spin(Duration(-1), [&polls]() { return ++polls == 5; }), 1);
+  EXPECT_EQ(polls, 5);
+  EXPECT_EQ(SpinHits(), hits + 1);
+}
+
+TEST(BusyPollBudgetTest, SpinGivesUpAfterBudget) {
+  BusyPollBudget budget(std::chrono::milliseconds(1));
+  const uint64_t misses = SpinMisses();
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(budget.Spin(Duration(-1), []() { return 0; }), 0);
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(1));
+  EXPECT_EQ(SpinMisses(), misses + 1);
+  EXPECT_EQ(budget.budget(), std::chrono::microseconds(500));
+}
+
+TEST(BusyPollBudgetTest, SpinFallsBackOnError) {
+  BusyPollBudget budget(std::chrono::seconds(10));
+  const uint64_t hits = SpinHits();
+  const uint64_t misses = SpinMisses();
+  int polls = 0;
+  EXPECT_EQ(budget.Spin(Duration(-1),
+                        [&polls]() {
+                          ++polls;
+                          return -1;
+                        }),
+            0);
+  EXPECT_EQ(polls, 1);
+  EXPECT_EQ(SpinHits(), hits);
+  EXPECT_EQ(SpinMisses(), misses);
+  EXPECT_EQ(budget.budget(), std::chrono::seconds(10));
+}
+
+TEST(BusyPollBudgetTest, SpinIsCappedByTimeout) {
+  BusyPollBudget budget(std::chrono::seconds(10));
+  int polls = 0;
+  EXPECT_EQ(budget.Spin(Duration::zero(),
+                        [&polls]() {
+                          ++polls;
+                          return 0;
+                        }),
+            0);
+  EXPECT_EQ(polls, 1);
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -522,6 +522,78 @@ TEST_F(EventPollerTest, TestEventPollerHandleChange) {
   close(sv[1]);
 }
 
+// Runs the poller until done is notified.
+void PollUntil(grpc_core::Notification& done) {
+  while (!done.HasBeenNotified()) {
+    g_event_poller->Work(std::chrono::milliseconds(10), []() {});
+  }
+}
+
+// Test that pollers which run recvmsg and sendmsg themselves complete them
+// once the socket is ready, and cancel them when the handle is shutdown.
+TEST_F(EventPollerTest, TestSubmitRecvmsgAndSendmsg) {
+  if (g_event_poller == nullptr || !g_event_poller->CanSubmitMsgOps()) {
+    return;
+  }
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+  for (int fd : sv) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    ASSERT_EQ(fcntl(fd, F_SETFL, flags | O_NONBLOCK), 0);
+  }
+  EventHandle* reader = g_event_poller->CreateHandle(sv[0], "reader", false);
+  EventHandle* writer = g_event_poller->CreateHandle(sv[1], "writer", false);
+
+  // Nothing has been sent yet, so the recvmsg completes once the sendmsg
+  // does.
+  char recv_buf[16];
+  struct iovec recv_iov = {recv_buf, sizeof(recv_buf)};
+  struct msghdr recv_msg;
+  memset(&recv_msg, 0, sizeof(recv_msg));
+  recv_msg.msg_iov = &recv_iov;
+  recv_msg.msg_iovlen = 1;
+  int recv_result = 0;
+  grpc_core::Notification recv_done;
+  ASSERT_TRUE(reader->SubmitRecvmsg(&recv_msg, [&](int result) {
+    recv_result = result;
+    recv_done.Notify();
+  }));
+  char send_buf[] = "hello";
+  struct iovec send_iov = {send_buf, 5};
+  struct msghdr send_msg;
+  memset(&send_msg, 0, sizeof(send_msg));
+  send_msg.msg_iov = &send_iov;
+  send_msg.msg_iovlen = 1;
+  int send_result = 0;
+  grpc_core::Notification send_done;
+  ASSERT_TRUE(writer->SubmitSendmsg(&send_msg, 0, [&](int result) {
+    send_result = result;
+    send_done.Notify();
+  }));
+  PollUntil(send_done);
+  PollUntil(recv_done);
+  EXPECT_EQ(send_result, 5);
+  ASSERT_EQ(recv_result, 5);
+  EXPECT_EQ(absl::string_view(recv_buf, 5), "hello");
+
+  // A pending recvmsg is cancelled by ShutdownHandle, after which no more
+  // requests are accepted.
+  int cancelled_result = 0;
+  grpc_core::Notification cancelled;
+  ASSERT_TRUE(reader->SubmitRecvmsg(&recv_msg, [&](int result) {
+    cancelled_result = result;
+    cancelled.Notify();
+  }));
+  reader->ShutdownHandle(absl::UnavailableError("shutdown"));
+  PollUntil(cancelled);
+  EXPECT_EQ(cancelled_result, -ECANCELED);
+  EXPECT_FALSE(reader->SubmitRecvmsg(&recv_msg, [](int) {}));
+
+  reader->OrphanHandle(nullptr, nullptr, "reader");
+  writer->ShutdownHandle(absl::UnavailableError("shutdown"));
+  writer->OrphanHandle(nullptr, nullptr, "writer");
+}
+
 std::atomic<int> kTotalActiveWakeupFdHandles{0};
 
 // A helper class representing one file descriptor. Its implemented using
@@ -32,6 +32,7 @@
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/gprpp/notification.h"
 #include "src/core/lib/gprpp/sync.h"
 
 using ::grpc_event_engine::experimental::EventEngine;
@@ -101,6 +102,36 @@ TEST(LockFreeEventTest, BasicTest) {
   event.DestroyEvent();
 }
 
+TEST(LockFreeEventTest, SetReadyAndTakeClosure) {
+  LockfreeEvent event(g_scheduler);
+  event.InitEvent();
+  // Nothing is waiting: the event is just marked ready.
+  EXPECT_EQ(event.SetReadyAndTakeClosure(), nullptr);
+  bool ran = false;
+  PosixEngineClosure* closure =
+      PosixEngineClosure::ToPermanentClosure([&ran](absl::Status status) {
+        EXPECT_TRUE(status.ok());
+        ran = true;
+      });
+  // The event is already ready, so NotifyOn schedules the closure.
+  grpc_core::Notification done;
+  PosixEngineClosure* scheduled = PosixEngineClosure::TestOnlyToClosure(
+      [&done](absl::Status /*status*/) { done.Notify(); });
+  event.NotifyOn(scheduled);
+  done.WaitForNotification();
+  // A waiting closure is handed back instead of being scheduled.
+  event.NotifyOn(closure);
+  EXPECT_EQ(event.SetReadyAndTakeClosure(), closure);
+  EXPECT_FALSE(ran);
+  closure->Run();
+  EXPECT_TRUE(ran);
+  // After shutdown there is nothing to take.
+  event.SetShutdown(absl::CancelledError("Shutdown"));
+  EXPECT_EQ(event.SetReadyAndTakeClosure(), nullptr);
+  delete closure;
+  event.DestroyEvent();
+}
+
 TEST(LockFreeEventTest, MultiThreadedTest) {
   std::vector<std::thread> threads;
   LockfreeEvent event(g_scheduler);
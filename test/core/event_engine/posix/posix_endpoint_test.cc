@@ -64,6 +64,7 @@ using Listener = ::grpc_event_engine::experimental::EventEngine::Listener;
 using namespace std::chrono_literals;
 
 constexpr int kMinMessageSize = 1024;
+constexpr int kRxZerocopyThreshold = 16 * 1024;
 constexpr int kNumConnections = 10;
 constexpr int kNumExchangedMessages = 100;
 std::atomic<int> g_num_active_connections{0};
@@ -76,7 +77,8 @@ struct Connection {
 std::list<Connection> CreateConnectedEndpoints(
     PosixEventPoller& poller, bool is_zero_copy_enabled, int num_connections,
     std::shared_ptr<EventEngine> posix_ee,
-    std::shared_ptr<EventEngine> oracle_ee) {
+    std::shared_ptr<EventEngine> oracle_ee,
+    bool is_rx_zero_copy_enabled = false) {
   std::list<Connection> connections;
   auto memory_quota = std::make_unique<grpc_core::MemoryQuota>("bar");
   std::string target_addr = absl::StrCat(
@@ -101,6 +103,11 @@ std::list<Connection> CreateConnectedEndpoints(
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD,
                     kMinMessageSize);
   }
+  if (is_rx_zero_copy_enabled) {
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD,
+                    kRxZerocopyThreshold);
+  }
   ChannelArgsEndpointConfig config(args);
   auto listener = oracle_ee->CreateListener(
       std::move(accept_cb),
@@ -325,6 +332,70 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   worker->Wait();
 }
 
+// Reads large messages with TCP receive zerocopy enabled on the client. Whether
+// the kernel maps the pages or falls back to copying them depends on the
+// route's MTU and the alignment of the payload, so the test only checks that
+// the data survives either way, including across reused receive regions.
+TEST_P(PosixEndpointTest, RxZerocopyTransferTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), 1, GetPosixEE(), GetOracleEE(),
+        /*is_rx_zero_copy_enabled=*/true);
+    auto it = connections.begin();
+    auto client_endpoint = std::move((*it).client_endpoint);
+    auto server_endpoint = std::move((*it).server_endpoint);
+    EXPECT_NE(client_endpoint, nullptr);
+    EXPECT_NE(server_endpoint, nullptr);
+    connections.erase(it);
+    for (size_t size : {size_t{1024 * 1024}, size_t{1024 * 1024 + 123},
+                        size_t{4 * 1024 * 1024}, size_t{256 * 1024 + 4095}}) {
+      std::string message(size, '\0');
+      for (size_t i = 0; i < size; ++i) {
+        message[i] = static_cast<char>('a' + i % 26);
+      }
+      ASSERT_TRUE(SendValidatePayload(message, server_endpoint.get(),
+                                      client_endpoint.get())
+                      .ok());
+    }
+  }
+  worker->Wait();
+}
+
+// Reads below the receive zerocopy threshold must take the copying path.
+TEST_P(PosixEndpointTest, RxZerocopyCopyFallbackTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), 1, GetPosixEE(), GetOracleEE(),
+        /*is_rx_zero_copy_enabled=*/true);
+    auto it = connections.begin();
+    auto client_endpoint = std::move((*it).client_endpoint);
+    auto server_endpoint = std::move((*it).server_endpoint);
+    EXPECT_NE(client_endpoint, nullptr);
+    EXPECT_NE(server_endpoint, nullptr);
+    connections.erase(it);
+    for (int i = 0; i < kNumExchangedMessages; i++) {
+      std::string message = GetNextSendMessage();
+      if (message.size() >= static_cast<size_t>(kRxZerocopyThreshold)) {
+        message.resize(kRxZerocopyThreshold - 1);
+      }
+      ASSERT_TRUE(SendValidatePayload(message, server_endpoint.get(),
+                                      client_endpoint.get())
+                      .ok());
+    }
+  }
+  worker->Wait();
+}
+
 // Test with zero copy enabled and disabled.
 INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointTest,
                          ::testing::ValuesIn({false, true}), &TestScenarioName);
@@ -25,7 +25,9 @@
 #include "gtest/gtest.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/port.h"
 
 // This test won't work except with posix sockets enabled
@@ -99,6 +101,35 @@ TEST(PosixEngineListenerUtils, ListenerContainerAddWildcardAddressesTest) {
   }
 }
 
+TEST(PosixEngineListenerUtils, ListenerContainerAddShardedAddressesTest) {
+  if (!PosixSocketWrapper::IsSocketReusePortSupported()) {
+    LOG(INFO) << "Skipping ListenerContainerAddShardedAddressesTest "
+                 "because SO_REUSEPORT is not supported.";
+    return;
+  }
+  constexpr int kNumShards = 4;
+  TestListenerSocketsContainer listener_sockets;
+  int port = grpc_pick_unused_port_or_die();
+  ChannelArgsEndpointConfig config(
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_TCP_LISTENER_SHARDS, kNumShards)
+          .Set(GRPC_ARG_TCP_LISTENER_CPU_STEERING, 1));
+  auto result = ListenerContainerAddWildcardAddresses(
+      listener_sockets, TcpOptionsFromEndpointConfig(config), port);
+  ASSERT_TRUE(result.ok());
+  EXPECT_GT(*result, 0);
+  port = *result;
+  // Each wildcard address is served by kNumShards sockets on the same port.
+  EXPECT_GE(listener_sockets.Size(), kNumShards);
+  EXPECT_LE(listener_sockets.Size(), 2 * kNumShards);
+  EXPECT_EQ(listener_sockets.Size() % kNumShards, 0);
+  for (auto socket = listener_sockets.begin(); socket != listener_sockets.end();
+       ++socket) {
+    EXPECT_EQ(ResolvedAddressGetPort((*socket).addr), port);
+    close(socket->sock.Fd());
+  }
+}
+
 #ifdef GRPC_HAVE_IFADDRS
 TEST(PosixEngineListenerUtils, ListenerContainerAddAllLocalAddressesTest) {
   TestListenerSocketsContainer listener_sockets;
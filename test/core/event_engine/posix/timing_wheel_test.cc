@@ -0,0 +1,232 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timing_wheel.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gprpp/time.h"
+
+using testing::AnyNumber;
+using testing::Mock;
+using testing::Return;
+using testing::StrictMock;
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+class MockClosure : public experimental::EventEngine::Closure {
+ public:
+  MOCK_METHOD(void, Run, ());
+};
+
+class MockHost : public TimerListHost {
+ public:
+  virtual ~MockHost() {}
+  MOCK_METHOD(grpc_core::Timestamp, Now, ());
+  MOCK_METHOD(void, Kick, ());
+};
+
+enum class CheckResult { kTimersFired, kCheckedAndEmpty, kNotChecked };
+
+CheckResult FinishCheck(
+    absl::optional<std::vector<experimental::EventEngine::Closure*>> result) {
+  if (!result.has_value()) return CheckResult::kNotChecked;
+  if (result->empty()) return CheckResult::kCheckedAndEmpty;
+  for (auto closure : *result) {
+    closure->Run();
+  }
+  return CheckResult::kTimersFired;
+}
+
+grpc_core::Timestamp Ms(int64_t ms) {
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(ms);
+}
+
+}  // namespace
+
+TEST(TimingWheelTest, Add) {
+  Timer timers[20];
+  StrictMock<MockClosure> closures[20];
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(100)));
+  TimingWheelTimerList timer_list(&host);
+
+  for (int i = 0; i < 10; i++) {
+    timer_list.TimerInit(&timers[i], Ms(110), &closures[i]);
+  }
+  for (int i = 10; i < 20; i++) {
+    timer_list.TimerInit(&timers[i], Ms(1110), &closures[i]);
+  }
+
+  // Only the first batch should be ready.
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(600)));
+  for (int i = 0; i < 10; i++) {
+    EXPECT_CALL(closures[i], Run());
+  }
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(&next)),
+            CheckResult::kTimersFired);
+  for (int i = 0; i < 10; i++) {
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+  EXPECT_LE(next, Ms(1110));
+
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(700)));
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(1600)));
+  for (int i = 10; i < 20; i++) {
+    EXPECT_CALL(closures[i], Run());
+  }
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  for (int i = 10; i < 20; i++) {
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(1700)));
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+}
+
+// Timers on every level of the wheel, and in the overflow list, fire exactly
+// at their deadline: not a tick early and not a tick late.
+TEST(TimingWheelTest, FiresAtDeadlineOnEveryLevel) {
+  const int64_t kStart = 1000;
+  const int64_t kDelays[] = {
+      1,           5,           255,           256,
+      257,         300,         65535,         65536,
+      70000,       16777216,    5 * 3600000LL, int64_t{1} << 32,
+      60 * 86400000LL,
+  };
+  constexpr size_t kNumTimers = sizeof(kDelays) / sizeof(kDelays[0]);
+  Timer timers[kNumTimers];
+  StrictMock<MockClosure> closures[kNumTimers];
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(kStart)));
+  TimingWheelTimerList timer_list(&host);
+  for (size_t i = 0; i < kNumTimers; i++) {
+    timer_list.TimerInit(&timers[i], Ms(kStart + kDelays[i]), &closures[i]);
+  }
+
+  for (size_t i = 0; i < kNumTimers; i++) {
+    const int64_t deadline = kStart + kDelays[i];
+    EXPECT_CALL(host, Now()).WillOnce(Return(Ms(deadline - 1)));
+    grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+    EXPECT_EQ(FinishCheck(timer_list.TimerCheck(&next)),
+              CheckResult::kCheckedAndEmpty)
+        << "delay " << kDelays[i];
+    EXPECT_LE(next, Ms(deadline)) << "delay " << kDelays[i];
+
+    EXPECT_CALL(host, Now()).WillOnce(Return(Ms(deadline)));
+    EXPECT_CALL(closures[i], Run());
+    EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+              CheckResult::kTimersFired)
+        << "delay " << kDelays[i];
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+}
+
+TEST(TimingWheelTest, Cancel) {
+  Timer timers[3];
+  StrictMock<MockClosure> closures[3];
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(0)));
+  TimingWheelTimerList timer_list(&host);
+  timer_list.TimerInit(&timers[0], Ms(10), &closures[0]);
+  timer_list.TimerInit(&timers[1], Ms(100000), &closures[1]);
+  timer_list.TimerInit(&timers[2], Ms(20), &closures[2]);
+
+  EXPECT_TRUE(timer_list.TimerCancel(&timers[0]));
+  EXPECT_FALSE(timer_list.TimerCancel(&timers[0]));
+  EXPECT_TRUE(timer_list.TimerCancel(&timers[1]));
+
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(200000)));
+  EXPECT_CALL(closures[2], Run());
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  // Already fired.
+  EXPECT_FALSE(timer_list.TimerCancel(&timers[2]));
+}
+
+// A timer earlier than any other kicks the host, and one whose deadline has
+// already passed fires on the next check.
+TEST(TimingWheelTest, EarlierTimerKicks) {
+  Timer timers[2];
+  StrictMock<MockClosure> closures[2];
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(1000)));
+  TimingWheelTimerList timer_list(&host);
+  timer_list.TimerInit(&timers[0], Ms(5000), &closures[0]);
+
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(1000)));
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(&next)),
+            CheckResult::kCheckedAndEmpty);
+  EXPECT_LE(next, Ms(5000));
+
+  EXPECT_CALL(host, Kick());
+  timer_list.TimerInit(&timers[1], Ms(900), &closures[1]);
+  Mock::VerifyAndClearExpectations(&host);
+
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(1001)));
+  EXPECT_CALL(closures[1], Run());
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_TRUE(timer_list.TimerCancel(&timers[0]));
+}
+
+// Cleaning up a list with pending timers.
+TEST(TimingWheelTest, Destruction) {
+  Timer timers[5];
+  StrictMock<MockClosure> closures[5];
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(0)));
+  TimingWheelTimerList timer_list(&host);
+  EXPECT_CALL(host, Kick()).Times(AnyNumber());
+  for (int i = 0; i < 5; i++) {
+    timer_list.TimerInit(&timers[i], Ms(100 * (i + 1)), &closures[i]);
+  }
+  EXPECT_CALL(host, Now()).WillOnce(Return(Ms(250)));
+  EXPECT_CALL(closures[0], Run());
+  EXPECT_CALL(closures[1], Run());
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_TRUE(timer_list.TimerCancel(&timers[3]));
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -17,19 +17,26 @@
 #include <chrono>
 #include <cmath>
 #include <cstddef>
+#include <fstream>
 #include <functional>
 #include <memory>
+#include <string>
 #include <thread>
 #include <tuple>
 #include <vector>
 
+#include "absl/cleanup/cleanup.h"
+#include "absl/strings/str_cat.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
 #include <grpc/support/thd_id.h>
 
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 #include "src/core/lib/gprpp/notification.h"
@@ -37,6 +44,11 @@
 #include "src/core/lib/gprpp/time.h"
 #include "test/core/test_util/test_config.h"
 
+#ifdef GPR_LINUX
+#include <stdio.h>
+#include <sys/stat.h>
+#endif
+
 namespace grpc_event_engine {
 namespace experimental {
 
@@ -299,6 +311,92 @@ TYPED_TEST(ThreadPoolTest, DISABLED_TestDumpStack) {
   p1.Quiesce();
 }
 
+TEST(WorkStealingThreadPoolNumaTest, RunsWorkAcrossSyntheticNodes) {
+  WorkStealingThreadPool p(4, NumaTopology::Synthetic(3),
+                           /*pin_threads_to_nodes=*/false);
+  constexpr int kClosures = 1000;
+  std::atomic<int> runs{0};
+  grpc_core::Notification n;
+  auto count = [&runs, &n]() {
+    if (runs.fetch_add(1) + 1 == 2 * kClosures) n.Notify();
+  };
+  for (int i = 0; i < kClosures; i++) {
+    // Each closure queues a follow up from a pool thread.
+    p.Run([&p, count]() {
+      count();
+      p.Run(count);
+    });
+  }
+  n.WaitForNotification();
+  p.Quiesce();
+}
+
+TEST(NumaTopologyTest, ParseCpuList) {
+  EXPECT_EQ(ParseCpuList("0-3,8,10-11\n"),
+            std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_EQ(ParseCpuList("5"), std::vector<int>({5}));
+  EXPECT_EQ(ParseCpuList(""), std::vector<int>());
+  EXPECT_FALSE(ParseCpuList("1-").has_value());
+  EXPECT_FALSE(ParseCpuList("3-1").has_value());
+  EXPECT_FALSE(ParseCpuList("a,b").has_value());
+}
+
+TEST(NumaTopologyTest, SyntheticSplitsEveryCpu) {
+  auto topology = NumaTopology::Synthetic(2);
+  size_t cpus = 0;
+  for (size_t node = 0; node < topology.num_nodes(); node++) {
+    for (int cpu : topology.cpus(node)) {
+      EXPECT_EQ(topology.NodeForCpu(cpu), node);
+      cpus++;
+    }
+  }
+  EXPECT_EQ(cpus, gpr_cpu_num_cores());
+  EXPECT_FALSE(topology.NodeForCpu(-1).has_value());
+}
+
+TEST(NumaTopologyTest, DiscoverWithoutSysfsIsFlat) {
+  auto topology = NumaTopology::Discover("/nonexistent/node");
+  EXPECT_EQ(topology.num_nodes(), 1u);
+  EXPECT_EQ(topology.cpus(0).size(), gpr_cpu_num_cores());
+}
+
+#ifdef GPR_LINUX
+TEST(NumaTopologyTest, DiscoverReadsSysfsLayout) {
+  char dir[] = "/tmp/numa_topology_test_XXXXXX";
+  ASSERT_NE(mkdtemp(dir), nullptr);
+  // Everything created under dir, removed in reverse order.
+  std::vector<std::string> created = {dir};
+  auto cleanup = absl::MakeCleanup([&created]() {
+    for (auto it = created.rbegin(); it != created.rend(); ++it) {
+      remove(it->c_str());
+    }
+  });
+  auto write = [&](const std::string& path, const std::string& contents) {
+    created.push_back(absl::StrCat(dir, path));
+    std::ofstream(created.back()) << contents;
+  };
+  auto make_dir = [&](const std::string& path) {
+    created.push_back(absl::StrCat(dir, path));
+    return mkdir(created.back().c_str(), 0700);
+  };
+  write("/online", "0-2\n");
+  ASSERT_EQ(make_dir("/node0"), 0);
+  ASSERT_EQ(make_dir("/node1"), 0);
+  ASSERT_EQ(make_dir("/node2"), 0);
+  write("/node0/cpulist", "0-1,4-5\n");
+  write("/node1/cpulist", "2-3,6-7\n");
+  // A memory only node.
+  write("/node2/cpulist", "\n");
+  auto topology = NumaTopology::Discover(dir);
+  ASSERT_EQ(topology.num_nodes(), 2u);
+  EXPECT_EQ(topology.cpus(0), std::vector<int>({0, 1, 4, 5}));
+  EXPECT_EQ(topology.cpus(1), std::vector<int>({2, 3, 6, 7}));
+  EXPECT_EQ(topology.NodeForCpu(5), 0u);
+  EXPECT_EQ(topology.NodeForCpu(6), 1u);
+  EXPECT_FALSE(topology.NodeForCpu(8).has_value());
+}
+#endif  // GPR_LINUX
+
 class BusyThreadCountTest : public testing::Test {};
 
 TEST_F(BusyThreadCountTest, StressTest) {
@@ -0,0 +1,218 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/http/message_compress/compression_filter.h"
+
+#include <memory>
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/compression.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/impl/compression_types.h>
+
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/transport/message.h"
+#include "test/core/filters/filter_test.h"
+
+using ::testing::_;
+using ::testing::StrictMock;
+
+namespace grpc_core {
+namespace {
+
+using ClientCompressionFilterTest = FilterTest<ClientCompressionFilter>;
+using ServerCompressionFilterTest = FilterTest<ServerCompressionFilter>;
+
+// Too short for gzip to make it any smaller, so it is only sent compressed on
+// a stream compressed call.
+constexpr absl::string_view kShortMessage = "hi";
+
+ChannelArgs StreamingArgs() {
+  return ChannelArgs()
+      .Set(GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM, GRPC_COMPRESS_GZIP)
+      .Set(GRPC_COMPRESSION_CHANNEL_ENABLE_STREAMING, true);
+}
+
+std::string StreamCompress(MessageStreamCompressor& compressor,
+                           absl::string_view message) {
+  SliceBuffer input;
+  SliceBuffer output;
+  input.Append(Slice::FromCopiedString(message));
+  EXPECT_TRUE(
+      compressor.Compress(input.c_slice_buffer(), output.c_slice_buffer()));
+  return output.JoinIntoString();
+}
+
+std::string StreamDecompress(MessageStreamDecompressor& decompressor,
+                             const Message& message) {
+  SliceBuffer input;
+  SliceBuffer output;
+  input.Append(Slice::FromCopiedString(message.payload()->JoinIntoString()));
+  EXPECT_TRUE(decompressor.Decompress(input.c_slice_buffer(),
+                                      output.c_slice_buffer()));
+  return output.JoinIntoString();
+}
+
+TEST_F(ClientCompressionFilterTest, OffersStreamCompression) {
+  StrictMock<FilterTest::Call> call(MakeChannel(StreamingArgs()).value());
+  if (IsStreamCompressionEnabled()) {
+    EXPECT_EVENT(
+        Started(&call, HasMetadataKeyValue("grpc-stream-compression", "1")));
+  } else {
+    EXPECT_EVENT(Started(&call, LacksMetadataKey("grpc-stream-compression")));
+  }
+  call.Start(call.NewClientMetadata());
+  Step();
+}
+
+TEST_F(ClientCompressionFilterTest, DoesNotOfferWithoutChannelArg) {
+  StrictMock<FilterTest::Call> call(
+      MakeChannel(ChannelArgs().Set(GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM,
+                                    GRPC_COMPRESS_GZIP))
+          .value());
+  EXPECT_EVENT(Started(&call, LacksMetadataKey("grpc-stream-compression")));
+  call.Start(call.NewClientMetadata());
+  Step();
+}
+
+TEST_F(ClientCompressionFilterTest, DecompressesStreamWhenServerAccepts) {
+  if (!IsStreamCompressionEnabled()) {
+    GTEST_SKIP() << "stream_compression experiment disabled";
+  }
+  StrictMock<FilterTest::Call> call(MakeChannel(StreamingArgs()).value());
+  auto compressor = MessageStreamCompressor::Create(GRPC_COMPRESS_GZIP);
+  ASSERT_NE(compressor, nullptr);
+  const std::string first(1024, 'y');
+  const std::string second = first + "z";
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata());
+  call.ForwardServerInitialMetadata(call.NewServerMetadata(
+      {{"grpc-encoding", "gzip"}, {"grpc-stream-compression", "1"}}));
+  call.ForwardMessageServerToClient(call.NewMessage(
+      StreamCompress(*compressor, first), GRPC_WRITE_INTERNAL_COMPRESS));
+  call.ForwardMessageServerToClient(call.NewMessage(
+      StreamCompress(*compressor, second), GRPC_WRITE_INTERNAL_COMPRESS));
+  EXPECT_EVENT(ForwardedServerInitialMetadata(&call, _));
+  EXPECT_EVENT(ForwardedMessageServerToClient(&call, HasMessagePayload(first)));
+  EXPECT_EVENT(
+      ForwardedMessageServerToClient(&call, HasMessagePayload(second)));
+  Step();
+}
+
+TEST_F(ClientCompressionFilterTest, DecompressesEachMessageWhenServerDeclines) {
+  StrictMock<FilterTest::Call> call(MakeChannel(StreamingArgs()).value());
+  const std::string message(1024, 'y');
+  SliceBuffer input;
+  SliceBuffer compressed;
+  input.Append(Slice::FromCopiedString(message));
+  ASSERT_EQ(grpc_msg_compress(GRPC_COMPRESS_GZIP, input.c_slice_buffer(),
+                              compressed.c_slice_buffer()),
+            1);
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata());
+  // A server without stream compression does not echo the header back.
+  call.ForwardServerInitialMetadata(
+      call.NewServerMetadata({{"grpc-encoding", "gzip"}}));
+  call.ForwardMessageServerToClient(call.NewMessage(
+      compressed.JoinIntoString(), GRPC_WRITE_INTERNAL_COMPRESS));
+  EXPECT_EVENT(ForwardedServerInitialMetadata(&call, _));
+  EXPECT_EVENT(
+      ForwardedMessageServerToClient(&call, HasMessagePayload(message)));
+  Step();
+}
+
+TEST_F(ServerCompressionFilterTest, AcceptsStreamCompressionWhenOffered) {
+  StrictMock<FilterTest::Call> call(MakeChannel(StreamingArgs()).value());
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata({{"grpc-stream-compression", "1"}}));
+  call.ForwardServerInitialMetadata(call.NewServerMetadata());
+  call.ForwardMessageServerToClient(call.NewMessage(kShortMessage));
+  if (!IsStreamCompressionEnabled()) {
+    EXPECT_EVENT(ForwardedServerInitialMetadata(
+        &call, LacksMetadataKey("grpc-stream-compression")));
+    EXPECT_EVENT(ForwardedMessageServerToClient(
+        &call, HasMessagePayload(kShortMessage)));
+    Step();
+    return;
+  }
+  auto decompressor = MessageStreamDecompressor::Create(GRPC_COMPRESS_GZIP);
+  ASSERT_NE(decompressor, nullptr);
+  EXPECT_EVENT(ForwardedServerInitialMetadata(
+      &call, HasMetadataKeyValue("grpc-stream-compression", "1")));
+  // Sent compressed even though that makes it bigger: the client has to see
+  // every message to follow the stream.
+  EXPECT_EVENT(ForwardedMessageServerToClient(
+                   &call, HasMessageFlags(GRPC_WRITE_INTERNAL_COMPRESS)))
+      .WillOnce([&](FilterTestBase::Call*, const Message& message) {
+        EXPECT_EQ(StreamDecompress(*decompressor, message), kShortMessage);
+      });
+  Step();
+}
+
+TEST_F(ServerCompressionFilterTest, DoesNotAcceptWhenNotOffered) {
+  StrictMock<FilterTest::Call> call(MakeChannel(StreamingArgs()).value());
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata());
+  call.ForwardServerInitialMetadata(call.NewServerMetadata());
+  call.ForwardMessageServerToClient(call.NewMessage(kShortMessage));
+  EXPECT_EVENT(ForwardedServerInitialMetadata(
+      &call, LacksMetadataKey("grpc-stream-compression")));
+  EXPECT_EVENT(ForwardedMessageServerToClient(
+      &call, HasMessagePayload(kShortMessage)));
+  Step();
+}
+
+TEST_F(ServerCompressionFilterTest, DoesNotAcceptWithoutChannelArg) {
+  StrictMock<FilterTest::Call> call(
+      MakeChannel(ChannelArgs().Set(GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM,
+                                    GRPC_COMPRESS_GZIP))
+          .value());
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata({{"grpc-stream-compression", "1"}}));
+  call.ForwardServerInitialMetadata(call.NewServerMetadata());
+  call.ForwardMessageServerToClient(call.NewMessage(kShortMessage));
+  EXPECT_EVENT(ForwardedServerInitialMetadata(
+      &call, LacksMetadataKey("grpc-stream-compression")));
+  EXPECT_EVENT(ForwardedMessageServerToClient(
+      &call, HasMessagePayload(kShortMessage)));
+  Step();
+}
+
+TEST_F(ServerCompressionFilterTest, DoesNotAcceptWithoutAlgorithm) {
+  StrictMock<FilterTest::Call> call(
+      MakeChannel(ChannelArgs().Set(GRPC_COMPRESSION_CHANNEL_ENABLE_STREAMING,
+                                    true))
+          .value());
+  EXPECT_EVENT(Started(&call, _));
+  call.Start(call.NewClientMetadata({{"grpc-stream-compression", "1"}}));
+  call.ForwardServerInitialMetadata(call.NewServerMetadata());
+  EXPECT_EVENT(ForwardedServerInitialMetadata(
+      &call, LacksMetadataKey("grpc-stream-compression")));
+  Step();
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
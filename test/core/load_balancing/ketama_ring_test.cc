@@ -0,0 +1,131 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/load_balancing/ring_hash/ketama_ring.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+std::string MakeAddress(size_t i) {
+  return absl::StrCat("10.0.", i / 256, ".", i % 256, ":443");
+}
+
+std::vector<KetamaRing::Endpoint> MakeEndpoints(size_t n, size_t count) {
+  std::vector<KetamaRing::Endpoint> endpoints;
+  for (size_t i = 0; i < n; ++i) endpoints.push_back({MakeAddress(i), count});
+  return endpoints;
+}
+
+// Returns the ring as (hash, address) pairs.
+std::vector<std::pair<uint64_t, std::string>> Entries(
+    const KetamaRing& ring, const std::vector<KetamaRing::Endpoint>& endpoints) {
+  std::vector<std::pair<uint64_t, std::string>> entries;
+  entries.reserve(ring.size());
+  for (const KetamaRing::Entry& entry : ring.entries()) {
+    entries.emplace_back(entry.hash, endpoints[entry.endpoint_index].address);
+  }
+  return entries;
+}
+
+TEST(KetamaRingTest, NoEndpoints) {
+  KetamaRing ring({});
+  EXPECT_EQ(ring.size(), 0);
+}
+
+TEST(KetamaRingTest, HashesAreSorted) {
+  const auto endpoints = MakeEndpoints(10, 100);
+  KetamaRing ring(endpoints);
+  ASSERT_EQ(ring.size(), 1000);
+  std::vector<size_t> counts(endpoints.size());
+  for (size_t i = 0; i < ring.size(); ++i) {
+    if (i > 0) {
+      EXPECT_LT(ring.entries()[i - 1].hash, ring.entries()[i].hash);
+    }
+    ++counts[ring.EndpointIndex(i)];
+  }
+  for (size_t count : counts) EXPECT_EQ(count, 100);
+}
+
+TEST(KetamaRingTest, FindPosition) {
+  KetamaRing ring(MakeEndpoints(3, 10));
+  const auto& entries = ring.entries();
+  // A hash goes to the first position whose hash is at least as large,
+  // wrapping around past the last one.
+  EXPECT_EQ(ring.FindPosition(0), 0);
+  EXPECT_EQ(ring.FindPosition(entries.front().hash), 0);
+  EXPECT_EQ(ring.FindPosition(entries[5].hash), 5);
+  EXPECT_EQ(ring.FindPosition(entries[5].hash + 1), 6);
+  EXPECT_EQ(ring.FindPosition(entries.back().hash), entries.size() - 1);
+  EXPECT_EQ(ring.FindPosition(entries.back().hash + 1), 0);
+}
+
+TEST(KetamaRingTest, IncrementalBuildMatchesFullBuild) {
+  std::mt19937 rng(42);
+  auto random = [&](size_t n) {
+    return std::uniform_int_distribution<size_t>(0, n - 1)(rng);
+  };
+  std::vector<KetamaRing::Endpoint> endpoints;
+  size_t next_address = 0;
+  for (; next_address < 20; ++next_address) {
+    endpoints.push_back({MakeAddress(next_address), 1 + random(50)});
+  }
+  auto ring = std::make_unique<KetamaRing>(endpoints);
+  for (int round = 0; round < 500; ++round) {
+    // Apply a few random changes.
+    const size_t changes = 1 + random(3);
+    for (size_t i = 0; i < changes; ++i) {
+      switch (endpoints.empty() ? 0 : random(4)) {
+        case 0:  // Add an endpoint.
+          endpoints.insert(endpoints.begin() + random(endpoints.size() + 1),
+                           {MakeAddress(next_address++), 1 + random(50)});
+          break;
+        case 1:  // Remove an endpoint.
+          endpoints.erase(endpoints.begin() + random(endpoints.size()));
+          break;
+        case 2:  // Change an endpoint's number of hashes.
+          endpoints[random(endpoints.size())].count = 1 + random(50);
+          break;
+        case 3:  // Move an endpoint.
+          std::swap(endpoints[random(endpoints.size())],
+                    endpoints[random(endpoints.size())]);
+          break;
+      }
+    }
+    auto incremental = std::make_unique<KetamaRing>(endpoints, ring.get());
+    KetamaRing full(endpoints);
+    ASSERT_EQ(Entries(*incremental, endpoints), Entries(full, endpoints))
+        << "round " << round;
+    ring = std::move(incremental);
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,98 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/load_balancing/ring_hash/maglev_table.h"
+
+namespace grpc_core {
+namespace {
+
+const int kNumEndpointsLow = 10;
+const int kNumEndpointsHigh = 10000;
+const int kRangeMultiplier = 10;
+
+const std::vector<MaglevTable::Endpoint>& Endpoints() {
+  static const NoDestruct<std::vector<MaglevTable::Endpoint>> kEndpoints([] {
+    std::vector<MaglevTable::Endpoint> endpoints;
+    endpoints.reserve(kNumEndpointsHigh);
+    for (int i = 0; i < kNumEndpointsHigh; ++i) {
+      endpoints.push_back(
+          {absl::StrCat("10.", i / 65536, ".", i / 256 % 256, ".", i % 256,
+                        ":443"),
+           static_cast<uint32_t>(1 + i % 4)});
+    }
+    return endpoints;
+  }());
+  return *kEndpoints;
+}
+
+// Args are the number of endpoints and the table size.
+void BM_MaglevTableBuild(benchmark::State& state) {
+  const auto endpoints =
+      absl::MakeConstSpan(Endpoints()).subspan(0, state.range(0));
+  size_t memory_usage = 0;
+  for (auto s : state) {
+    MaglevTable table(endpoints, state.range(1));
+    memory_usage = table.MemoryUsage();
+  }
+  state.counters["table_bytes"] = memory_usage;
+}
+BENCHMARK(BM_MaglevTableBuild)
+    ->ArgsProduct({benchmark::CreateRange(kNumEndpointsLow, kNumEndpointsHigh,
+                                          kRangeMultiplier),
+                   {MaglevTable::kDefaultTableSize, 655373}});
+
+void BM_MaglevTablePick(benchmark::State& state) {
+  const MaglevTable table(
+      absl::MakeConstSpan(Endpoints()).subspan(0, state.range(0)),
+      state.range(1));
+  std::vector<uint64_t> hashes(1024);
+  absl::BitGen bit_gen;
+  for (uint64_t& hash : hashes) hash = absl::Uniform<uint64_t>(bit_gen);
+  size_t i = 0;
+  for (auto s : state) {
+    benchmark::DoNotOptimize(
+        table.EndpointIndex(table.Slot(hashes[i++ % hashes.size()])));
+  }
+}
+BENCHMARK(BM_MaglevTablePick)
+    ->ArgsProduct({benchmark::CreateRange(kNumEndpointsLow, kNumEndpointsHigh,
+                                          kRangeMultiplier),
+                   {MaglevTable::kDefaultTableSize, 655373}});
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,146 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/load_balancing/ring_hash/maglev_table.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr uint64_t kTableSize = 65537;
+
+std::vector<MaglevTable::Endpoint> MakeEndpoints(size_t n) {
+  std::vector<MaglevTable::Endpoint> endpoints;
+  for (size_t i = 0; i < n; ++i) {
+    endpoints.push_back({absl::StrCat("10.0.", i / 256, ".", i % 256, ":443")});
+  }
+  return endpoints;
+}
+
+// Returns the key of the endpoint owning each slot of the table.
+std::vector<std::string> SlotOwners(
+    const std::vector<MaglevTable::Endpoint>& endpoints, uint64_t table_size) {
+  MaglevTable table(endpoints, table_size);
+  std::vector<std::string> owners;
+  owners.reserve(table.size());
+  for (size_t slot = 0; slot < table.size(); ++slot) {
+    owners.push_back(endpoints[table.EndpointIndex(slot)].key);
+  }
+  return owners;
+}
+
+TEST(MaglevTableTest, IsPrime) {
+  EXPECT_FALSE(MaglevTable::IsPrime(0));
+  EXPECT_FALSE(MaglevTable::IsPrime(1));
+  EXPECT_TRUE(MaglevTable::IsPrime(2));
+  EXPECT_TRUE(MaglevTable::IsPrime(3));
+  EXPECT_FALSE(MaglevTable::IsPrime(65535));
+  EXPECT_TRUE(MaglevTable::IsPrime(MaglevTable::kDefaultTableSize));
+  EXPECT_TRUE(MaglevTable::IsPrime(MaglevTable::kMaxTableSize));
+}
+
+TEST(MaglevTableTest, NoEndpoints) {
+  MaglevTable table({}, kTableSize);
+  EXPECT_EQ(table.size(), 0);
+}
+
+TEST(MaglevTableTest, SlotForHash) {
+  MaglevTable table(MakeEndpoints(3), kTableSize);
+  ASSERT_EQ(table.size(), kTableSize);
+  EXPECT_EQ(table.Slot(12345), 12345);
+  EXPECT_EQ(table.Slot(kTableSize + 7), 7);
+  EXPECT_EQ(table.MemoryUsage(), kTableSize * sizeof(uint32_t));
+}
+
+TEST(MaglevTableTest, SlotsAreSplitEvenly) {
+  const auto endpoints = MakeEndpoints(10);
+  MaglevTable table(endpoints, kTableSize);
+  std::vector<size_t> counts(endpoints.size());
+  for (size_t slot = 0; slot < table.size(); ++slot) {
+    ++counts[table.EndpointIndex(slot)];
+  }
+  for (size_t count : counts) {
+    EXPECT_GE(count, kTableSize / 10);
+    EXPECT_LE(count, kTableSize / 10 + 1);
+  }
+}
+
+TEST(MaglevTableTest, SlotsAreSplitByWeight) {
+  auto endpoints = MakeEndpoints(3);
+  endpoints[0].weight = 1;
+  endpoints[1].weight = 2;
+  endpoints[2].weight = 3;
+  MaglevTable table(endpoints, kTableSize);
+  std::vector<size_t> counts(endpoints.size());
+  for (size_t slot = 0; slot < table.size(); ++slot) {
+    ++counts[table.EndpointIndex(slot)];
+  }
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    const double expected = kTableSize * endpoints[i].weight / 6.0;
+    EXPECT_NEAR(counts[i], expected, 2) << "endpoint " << i;
+  }
+}
+
+TEST(MaglevTableTest, IndependentOfEndpointOrder) {
+  const auto endpoints = MakeEndpoints(50);
+  const std::vector<MaglevTable::Endpoint> reversed(endpoints.rbegin(),
+                                                    endpoints.rend());
+  EXPECT_EQ(SlotOwners(endpoints, kTableSize),
+            SlotOwners(reversed, kTableSize));
+}
+
+TEST(MaglevTableTest, FewSlotsMoveWhenAnEndpointIsRemoved) {
+  auto endpoints = MakeEndpoints(100);
+  const auto before = SlotOwners(endpoints, kTableSize);
+  const std::string removed = endpoints[42].key;
+  endpoints.erase(endpoints.begin() + 42);
+  const auto after = SlotOwners(endpoints, kTableSize);
+  size_t moved = 0;
+  for (size_t slot = 0; slot < kTableSize; ++slot) {
+    if (before[slot] != removed && before[slot] != after[slot]) ++moved;
+  }
+  // The removed endpoint's 1% of the slots must move; Maglev moves few
+  // others.
+  EXPECT_LT(moved, kTableSize / 50);
+}
+
+TEST(MaglevTableTest, FewSlotsMoveWhenAnEndpointIsAdded) {
+  auto endpoints = MakeEndpoints(101);
+  const MaglevTable::Endpoint added = endpoints.back();
+  endpoints.pop_back();
+  const auto before = SlotOwners(endpoints, kTableSize);
+  endpoints.push_back(added);
+  const auto after = SlotOwners(endpoints, kTableSize);
+  size_t moved = 0;
+  for (size_t slot = 0; slot < kTableSize; ++slot) {
+    if (after[slot] != added.key && before[slot] != after[slot]) ++moved;
+  }
+  EXPECT_LT(moved, kTableSize / 50);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
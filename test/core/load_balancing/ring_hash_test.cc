@@ -29,14 +29,17 @@
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
 #include "absl/types/optional.h"
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
 #include <grpc/support/json.h>
 
+#include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/xxhash_inline.h"
 #include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/ring_hash/maglev_table.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/json/json.h"
 #include "test/core/load_balancing/lb_policy_test_lib.h"
@@ -55,7 +58,8 @@ class RingHashTest : public LoadBalancingPolicyTest {
   RingHashTest() : LoadBalancingPolicyTest("ring_hash_experimental") {}
 
   static RefCountedPtr<LoadBalancingPolicy::Config> MakeRingHashConfig(
-      int min_ring_size = 0, int max_ring_size = 0) {
+      int min_ring_size = 0, int max_ring_size = 0,
+      int maglev_table_size = 0) {
     Json::Object fields;
     if (min_ring_size > 0) {
       fields["minRingSize"] = Json::FromString(absl::StrCat(min_ring_size));
@@ -63,6 +67,10 @@ class RingHashTest : public LoadBalancingPolicyTest {
     if (max_ring_size > 0) {
       fields["maxRingSize"] = Json::FromString(absl::StrCat(max_ring_size));
     }
+    if (maglev_table_size > 0) {
+      fields["maglevTableSize"] =
+          Json::FromString(absl::StrCat(maglev_table_size));
+    }
     return MakeConfig(Json::FromArray({Json::FromObject(
         {{"ring_hash_experimental", Json::FromObject(fields)}})}));
   }
@@ -184,6 +192,132 @@ TEST_F(RingHashTest, MultipleAddressesPerEndpoint) {
   EXPECT_EQ(address, kEndpoint1Addresses[1]);
 }
 
+TEST_F(RingHashTest, EndpointReplaced) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakeRingHashConfig()), lb_policy()),
+      absl::OkStatus());
+  ExpectState(GRPC_CHANNEL_IDLE);
+  // Replace the first endpoint.  The new ring keeps the hashes of the
+  // other two endpoints and adds the new endpoint's.
+  const std::array<absl::string_view, 3> kNewAddresses = {
+      "ipv4:127.0.0.1:444", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kNewAddresses, MakeRingHashConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  auto* address0_attribute = MakeHashAttribute(kNewAddresses[0]);
+  ExpectPickQueued(picker.get(), {address0_attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  auto* subchannel = FindSubchannel(kNewAddresses[0]);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get(), {address0_attribute});
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  auto address = ExpectPickComplete(picker.get(), {address0_attribute});
+  EXPECT_EQ(address, kNewAddresses[0]);
+}
+
+TEST_F(RingHashTest, PoliciesWithTheSameEndpointsShareARing) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:451", "ipv4:127.0.0.1:452", "ipv4:127.0.0.1:453"};
+  const size_t initial_rings = RingHashTestOnlySharedRingCount();
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakeRingHashConfig()), lb_policy()),
+      absl::OkStatus());
+  ExpectState(GRPC_CHANNEL_IDLE);
+  EXPECT_EQ(RingHashTestOnlySharedRingCount(), initial_rings + 1);
+  // A second policy with the same endpoints and config gets the same ring.
+  auto helper = std::make_unique<FakeHelper>(this);
+  FakeHelper* second_helper = helper.get();
+  auto second_policy =
+      CoreConfiguration::Get().lb_policy_registry().CreateLoadBalancingPolicy(
+          lb_policy_name_, LoadBalancingPolicy::Args{work_serializer_,
+                                                     std::move(helper),
+                                                     channel_args_});
+  ASSERT_NE(second_policy, nullptr);
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeRingHashConfig()),
+                        second_policy.get()),
+            absl::OkStatus());
+  auto update = second_helper->GetNextStateUpdate();
+  ASSERT_TRUE(update.has_value());
+  EXPECT_EQ(update->state, GRPC_CHANNEL_IDLE);
+  second_helper->ExpectQueueEmpty();
+  EXPECT_EQ(RingHashTestOnlySharedRingCount(), initial_rings + 1);
+  // Move the first policy to other endpoints.  The ring stays shared as
+  // long as the second policy uses it.
+  const std::array<absl::string_view, 2> kOtherAddresses = {
+      "ipv4:127.0.0.1:454", "ipv4:127.0.0.1:455"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kOtherAddresses, MakeRingHashConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  ExpectState(GRPC_CHANNEL_IDLE);
+  WaitForWorkSerializerToFlush();
+  EXPECT_EQ(RingHashTestOnlySharedRingCount(), initial_rings + 2);
+  // Destroying the ring removes it from the shared rings.
+  update.reset();
+  {
+    ExecCtx exec_ctx;
+    second_policy.reset();
+  }
+  WaitForWorkSerializerToFlush();
+  EXPECT_EQ(RingHashTestOnlySharedRingCount(), initial_rings + 1);
+}
+
+TEST_F(RingHashTest, MaglevTable) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakeRingHashConfig(
+                                        0, 0, MaglevTable::kDefaultTableSize)),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  // Find the endpoint that the table gives the request hash to.
+  std::vector<MaglevTable::Endpoint> endpoints;
+  for (absl::string_view address : kAddresses) {
+    endpoints.push_back({std::string(absl::StripPrefix(address, "ipv4:"))});
+  }
+  const MaglevTable table(endpoints, MaglevTable::kDefaultTableSize);
+  auto* attribute = MakeHashAttribute(kAddresses[0]);
+  const absl::string_view expected_address = kAddresses[table.EndpointIndex(
+      table.Slot(attribute->request_hash()))];
+  ExpectPickQueued(picker.get(), {attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  auto* subchannel = FindSubchannel(expected_address);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get(), {attribute});
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  auto address = ExpectPickComplete(picker.get(), {attribute});
+  EXPECT_EQ(address, expected_address);
+}
+
+TEST_F(RingHashTest, MaglevTableSizeMustBePrime) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          Json::FromArray({Json::FromObject(
+              {{"ring_hash_experimental",
+                Json::FromObject(
+                    {{"maglevTableSize", Json::FromNumber(65536)}})}})}));
+  EXPECT_EQ(config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_THAT(config.status().message(),
+              ::testing::HasSubstr(
+                  "errors validating ring_hash LB policy config: ["
+                  "field:maglevTableSize "
+                  "error:must be a prime number no larger than 5000011]"))
+      << config.status();
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <grpc/grpc.h>
@@ -56,6 +58,48 @@ void BM_WakeupParticipant(benchmark::State& state) {
 }
 BENCHMARK(BM_WakeupParticipant);
 
+// Spawn a party's worth of participants that complete on first poll. Past
+// party_detail::kPrimaryParticipants participants, the rest go to the
+// overflow block.
+void BM_SpawnParticipants(benchmark::State& state) {
+  const int n = state.range(0);
+  for (auto _ : state) {
+    auto party = Party::Make(SimpleArenaAllocator()->MakeArena());
+    for (int i = 0; i < n; i++) {
+      party->Spawn(
+          "participant", []() { return Success{}; }, [](StatusFlag) {});
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_SpawnParticipants)->Arg(4)->Arg(16)->Arg(64);
+
+// Wake every participant of a party from outside of it, one owning waker at
+// a time.
+void BM_WakeupParticipants(benchmark::State& state) {
+  const int n = state.range(0);
+  std::vector<Waker> wakers(n);
+  bool done = false;
+  auto party = Party::Make(SimpleArenaAllocator()->MakeArena());
+  for (int i = 0; i < n; i++) {
+    party->Spawn(
+        "participant",
+        [&wakers, &done, i]() -> Poll<StatusFlag> {
+          if (done) return Success{};
+          wakers[i] = GetContext<Activity>()->MakeOwningWaker();
+          return Pending{};
+        },
+        [](StatusFlag) {});
+  }
+  for (auto _ : state) {
+    for (auto& waker : wakers) waker.Wakeup();
+  }
+  done = true;
+  for (auto& waker : wakers) waker.Wakeup();
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_WakeupParticipants)->Arg(4)->Arg(16)->Arg(64);
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -20,6 +20,7 @@
 #include <atomic>
 #include <memory>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -270,6 +271,72 @@ TEST_F(PartyTest, CanBulkSpawn) {
   n2.WaitForNotification();
 }
 
+TEST_F(PartyTest, CanRunMoreParticipantsThanPrimarySlots) {
+  auto party = MakeParty();
+  InterActivityLatch<void> latch;
+  std::atomic<size_t> completed{0};
+  Notification n;
+  // Leave one slot for the setter.
+  constexpr size_t kWaiters = party_detail::kMaxParticipants - 1;
+  for (size_t i = 0; i < kWaiters; i++) {
+    party->Spawn(
+        "waiter", [&latch]() { return latch.Wait(); },
+        [&completed, &n](Empty) {
+          if (completed.fetch_add(1) + 1 == kWaiters) n.Notify();
+        });
+  }
+  EXPECT_EQ(completed.load(), 0u);
+  party->Spawn(
+      "setter",
+      [&latch]() {
+        latch.Set();
+        return Empty{};
+      },
+      [](Empty) {});
+  n.WaitForNotification();
+}
+
+TEST_F(PartyTest, CanBulkSpawnIntoOverflow) {
+  auto party = MakeParty();
+  std::atomic<size_t> completed{0};
+  Notification n;
+  {
+    Party::BulkSpawner spawner(party.get());
+    for (size_t i = 0; i < 40; i++) {
+      spawner.Spawn(
+          "spawn", []() { return Empty{}; },
+          [&completed, &n](Empty) {
+            if (completed.fetch_add(1) + 1 == 40) n.Notify();
+          });
+    }
+  }
+  n.WaitForNotification();
+}
+
+TEST_F(PartyTest, DestroysPendingOverflowParticipants) {
+  struct Tracker {
+    explicit Tracker(std::atomic<int>* live) : live(live) { ++*live; }
+    Tracker(Tracker&& other) noexcept
+        : live(std::exchange(other.live, nullptr)) {}
+    ~Tracker() {
+      if (live != nullptr) --*live;
+    }
+    std::atomic<int>* live;
+  };
+  std::atomic<int> live{0};
+  {
+    auto party = MakeParty();
+    for (int i = 0; i < 40; i++) {
+      party->Spawn(
+          "pending",
+          [tracker = Tracker(&live)]() -> Poll<Empty> { return Pending{}; },
+          [](Empty) { FAIL() << "pending participant completed"; });
+    }
+    EXPECT_EQ(live.load(), 40);
+  }
+  EXPECT_EQ(live.load(), 0);
+}
+
 TEST_F(PartyTest, ThreadStressTest) {
   auto party = MakeParty();
   std::vector<std::thread> threads;
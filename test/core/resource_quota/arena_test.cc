@@ -383,6 +383,63 @@ TEST(ArenaTest, AccurateByteCountWithAllocation) {
   arena.reset();
 }
 
+TEST(ArenaZonePoolTest, BlockSizes) {
+  EXPECT_EQ(ArenaZonePool::BlockSize(1), ArenaZonePool::kMinBlockSize);
+  EXPECT_EQ(ArenaZonePool::BlockSize(1024), 1024u);
+  EXPECT_EQ(ArenaZonePool::BlockSize(1025), 2048u);
+  EXPECT_EQ(ArenaZonePool::BlockSize(ArenaZonePool::kMaxBlockSize),
+            ArenaZonePool::kMaxBlockSize);
+  EXPECT_EQ(ArenaZonePool::BlockSize(ArenaZonePool::kMaxBlockSize + 1),
+            ArenaZonePool::kMaxBlockSize + 1);
+}
+
+TEST(ArenaZonePoolTest, RecyclesBlocksBySizeClass) {
+  // A single shard, so that blocks are recycled whichever cpu runs the test.
+  ArenaZonePool pool(MakeMemoryQuota("test")->CreateMemoryOwner(), 1024 * 1024,
+                     /*max_shards=*/1);
+  void* p = pool.Alloc(1000);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % ArenaZonePool::kAlignment, 0u);
+  pool.Free(p, 1000);
+  EXPECT_EQ(pool.cached_bytes(), 1024u);
+  // A different size class misses.
+  void* q = pool.Alloc(2000);
+  EXPECT_NE(q, p);
+  EXPECT_EQ(pool.cached_bytes(), 1024u);
+  // The same size class hits.
+  EXPECT_EQ(pool.Alloc(600), p);
+  EXPECT_EQ(pool.cached_bytes(), 0u);
+  pool.Free(p, 600);
+  pool.Free(q, 2000);
+  EXPECT_EQ(pool.Drain(), 1024u + 2048u);
+  EXPECT_EQ(pool.cached_bytes(), 0u);
+}
+
+TEST(ArenaZonePoolTest, CachedBytesAreBounded) {
+  ArenaZonePool pool(MakeMemoryQuota("test")->CreateMemoryOwner(), 2048);
+  std::vector<void*> blocks;
+  for (int i = 0; i < 4; i++) blocks.push_back(pool.Alloc(1024));
+  for (void* p : blocks) pool.Free(p, 1024);
+  EXPECT_LE(pool.cached_bytes(), 2048u);
+  // Blocks beyond the largest size class are never cached.
+  pool.Free(pool.Alloc(ArenaZonePool::kMaxBlockSize + 1),
+            ArenaZonePool::kMaxBlockSize + 1);
+  EXPECT_LE(pool.cached_bytes(), 2048u);
+}
+
+TEST(ArenaTest, InitialZoneIsRecycled) {
+  ArenaZonePool pool(MakeMemoryQuota("test")->CreateMemoryOwner(), 1024 * 1024,
+                     /*max_shards=*/1);
+  ArenaZonePool::TestOnlySetGlobal(&pool);
+  auto factory = SimpleArenaAllocator(1000);
+  const Arena* first = factory->MakeArena().get();
+  EXPECT_GT(pool.cached_bytes(), 0u);
+  auto arena = factory->MakeArena();
+  EXPECT_EQ(arena.get(), first);
+  EXPECT_EQ(pool.cached_bytes(), 0u);
+  arena.reset();
+  ArenaZonePool::TestOnlySetGlobal(nullptr);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char* argv[]) {
@@ -171,6 +171,29 @@ TEST(MemoryQuotaTest, NoBunchingIfIdle) {
   EXPECT_GE(count_reclaimers_called.load(std::memory_order_relaxed), 8000);
 }
 
+TEST(MemoryQuotaTest, CpuCachesHoldLittleOfTheQuota) {
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(64 * 1024 * 1024);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&memory_quota]() {
+      ExecCtx exec_ctx;
+      for (int j = 0; j < 1000; j++) {
+        auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+        memory_allocator.Release(memory_allocator.Reserve(256 * 1024));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  // With every allocator gone, only bytes parked in per cpu caches can still
+  // count as used.
+  auto memory_owner = memory_quota.CreateMemoryOwner();
+  EXPECT_LE(memory_owner.GetPressureInfo().instantaneous_pressure, 1.0 / 64);
+  // Shrinking the quota hands those bytes back.
+  memory_quota.SetSize(1024 * 1024);
+  EXPECT_LE(memory_owner.GetPressureInfo().instantaneous_pressure, 0.01);
+}
+
 TEST(MemoryQuotaTest, AllMemoryQuotas) {
   auto gather = []() {
     std::set<std::string> all_names;
@@ -0,0 +1,148 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/slice/interned_slice.h"
+
+#include <stdlib.h>
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/internal/memory_allocator_impl.h>
+#include <grpc/event_engine/memory_request.h>
+#include <grpc/slice.h>
+
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+namespace {
+
+std::string LongString(int i) {
+  return "x-mesh-custom-header-" + std::string(16, 'a') + std::to_string(i);
+}
+
+// Keeps count of the bytes reserved through it.
+class CountingAllocatorImpl final
+    : public grpc_event_engine::experimental::internal::MemoryAllocatorImpl {
+ public:
+  size_t Reserve(MemoryRequest request) override {
+    used_ += request.min();
+    return request.min();
+  }
+  grpc_slice MakeSlice(MemoryRequest) override { abort(); }
+  void Release(size_t n) override {
+    ASSERT_GE(used_, n);
+    used_ -= n;
+  }
+  void Shutdown() override {}
+
+  size_t used() const { return used_; }
+
+ private:
+  size_t used_ = 0;
+};
+
+MemoryAllocator TestAllocator() {
+  return MemoryAllocator(std::make_shared<CountingAllocatorImpl>());
+}
+
+TEST(InternedSliceTest, SameContentsShareBytes) {
+  InternedSliceTable table(TestAllocator());
+  const std::string key = LongString(0);
+  Slice a = table.Intern(key);
+  Slice b = table.Intern(key);
+  EXPECT_EQ(a.as_string_view(), key);
+  EXPECT_EQ(a.begin(), b.begin());
+  EXPECT_EQ(table.size(), 1);
+}
+
+TEST(InternedSliceTest, ShortStringsAreInlined) {
+  InternedSliceTable table(TestAllocator());
+  Slice a = table.Intern("x-short");
+  EXPECT_EQ(a.as_string_view(), "x-short");
+  EXPECT_EQ(a.c_slice().refcount, nullptr);
+  EXPECT_EQ(table.size(), 0);
+}
+
+TEST(InternedSliceTest, EvictedSlicesStayValid) {
+  InternedSliceTable table(TestAllocator(), 1);
+  const std::string key = LongString(0);
+  Slice held = table.Intern(key);
+  // With one entry per shard, some of these replace key.
+  for (int i = 1; i <= 100; i++) table.Intern(LongString(i));
+  Slice again = table.Intern(key);
+  EXPECT_NE(again.begin(), held.begin());
+  EXPECT_EQ(held.as_string_view(), key);
+  EXPECT_EQ(again.as_string_view(), key);
+}
+
+TEST(InternedSliceTest, RecentlyInternedSurvives) {
+  InternedSliceTable table(TestAllocator(), 2);
+  const std::string key = LongString(0);
+  Slice held = table.Intern(key);
+  // Re-interning key before each new string keeps it the most recent entry
+  // of its shard, so only the other entries are evicted.
+  for (int i = 1; i <= 100; i++) {
+    EXPECT_EQ(table.Intern(key).begin(), held.begin());
+    table.Intern(LongString(i));
+  }
+}
+
+TEST(InternedSliceTest, TableStaysBounded) {
+  InternedSliceTable table(TestAllocator(), 4);
+  for (int i = 0; i < 1000; i++) table.Intern(LongString(i));
+  EXPECT_LE(table.size(), 4 * InternedSliceTable::kShards);
+}
+
+TEST(InternedSliceTest, LongStringsAreCopied) {
+  InternedSliceTable table(TestAllocator());
+  const std::string key(InternedSliceTable::kMaxInternedLength + 1, 'k');
+  Slice a = table.Intern(key);
+  Slice b = table.Intern(key);
+  EXPECT_EQ(a.as_string_view(), key);
+  EXPECT_NE(a.begin(), b.begin());
+  EXPECT_EQ(table.size(), 0);
+}
+
+TEST(InternedSliceTest, ChargesAllocator) {
+  auto counter = std::make_shared<CountingAllocatorImpl>();
+  {
+    InternedSliceTable table((MemoryAllocator(counter)), 4);
+    table.Intern(LongString(0));
+    const size_t one_entry = counter->used();
+    EXPECT_GT(one_entry, LongString(0).size());
+    table.Intern(LongString(0));
+    EXPECT_EQ(counter->used(), one_entry);
+    // Oversized keys are neither kept nor charged.
+    for (int i = 0; i < 100; i++) {
+      table.Intern(std::string(1024, 'k') + std::to_string(i));
+    }
+    EXPECT_EQ(counter->used(), one_entry);
+    // Eviction returns what it frees, so the charge stays bounded.
+    for (int i = 1; i < 1000; i++) table.Intern(LongString(i));
+    EXPECT_LE(counter->used(), 4 * InternedSliceTable::kShards * 2 * one_entry);
+  }
+  EXPECT_EQ(counter->used(), 0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -30,6 +30,7 @@
 #include <grpc/status.h>
 #include <grpcpp/server.h>
 
+#include "src/core/ext/transport/chaotic_good/chaotic_good_transport.h"
 #include "src/core/ext/transport/chaotic_good/client/chaotic_good_connector.h"
 #include "src/core/lib/address_utils/parse_address.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -131,6 +132,16 @@ TEST_F(ChaoticGoodServerTest, Connect) {
   connect_finished_.WaitForNotification();
 }
 
+TEST_F(ChaoticGoodServerTest, ConnectWithDataLanes) {
+  args_.channel_args =
+      args_.channel_args.Set(GRPC_ARG_CHAOTIC_GOOD_DATA_LANES, 4);
+  GRPC_CLOSURE_INIT(&on_connecting_finished_, OnConnectingFinished, this,
+                    grpc_schedule_on_exec_ctx);
+  connector_->Connect(args_, &connecting_result_, &on_connecting_finished_);
+  connect_finished_.WaitForNotification();
+  EXPECT_TRUE(connecting_successful_);
+}
+
 TEST_F(ChaoticGoodServerTest, ConnectAndShutdown) {
   Notification connect_finished;
   GRPC_CLOSURE_INIT(&on_connecting_finished_, OnConnectingFinished, this,
@@ -176,6 +176,28 @@ TEST(BinEncoderTest, MainTest) {
   expect_binary_header("-bin", 0);
 }
 
+TEST(BinEncoderTest, HuffmanCompressedLength) {
+  for (const char* s : {"", "a", "www.example.com", "no-cache", "private",
+                        "Mon, 21 Oct 2013 20:13:21 GMT", "\xff\xfe\xfd"}) {
+    grpc_slice input = grpc_slice_from_static_string(s);
+    grpc_slice compressed = grpc_chttp2_huffman_compress(input);
+    EXPECT_EQ(grpc_chttp2_huffman_compressed_length(input),
+              GRPC_SLICE_LENGTH(compressed))
+        << s;
+    grpc_slice output = grpc_empty_slice();
+    const bool smaller =
+        grpc_chttp2_huffman_compress_if_smaller(input, &output);
+    EXPECT_EQ(smaller, GRPC_SLICE_LENGTH(compressed) < strlen(s)) << s;
+    if (smaller) {
+      EXPECT_TRUE(grpc_slice_eq(output, compressed)) << s;
+    } else {
+      EXPECT_EQ(GRPC_SLICE_LENGTH(output), 0) << s;
+    }
+    grpc_slice_unref(output);
+    grpc_slice_unref(compressed);
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
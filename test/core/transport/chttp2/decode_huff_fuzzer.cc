@@ -25,6 +25,7 @@
 #include "absl/types/optional.h"
 
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multisym.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 
 bool squelch = true;
@@ -87,6 +88,16 @@ absl::optional<std::vector<uint8_t>> DecodeHuffFast(const uint8_t* begin,
   return v;
 }
 
+absl::optional<std::vector<uint8_t>> DecodeHuffMultiSym(const uint8_t* begin,
+                                                        const uint8_t* end) {
+  std::vector<uint8_t> v;
+  auto f = [&](uint8_t x) { v.push_back(x); };
+  if (!grpc_core::MultiSymHuffDecoder<decltype(f)>(f, begin, end).Run()) {
+    return absl::nullopt;
+  }
+  return v;
+}
+
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
   auto slow = DecodeHuffSlow(data, data + size);
   auto fast = DecodeHuffFast(data, data + size);
@@ -96,5 +107,12 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
             ToString(slow).c_str(), ToString(fast).c_str());
     abort();
   }
+  auto multisym = DecodeHuffMultiSym(data, data + size);
+  if (slow != multisym) {
+    fprintf(stderr, "MISMATCH:\ninpt: %s\nslow: %s\nmultisym: %s\n",
+            ToString(std::vector<uint8_t>(data, data + size)).c_str(),
+            ToString(slow).c_str(), ToString(multisym).c_str());
+    abort();
+  }
   return 0;
 }
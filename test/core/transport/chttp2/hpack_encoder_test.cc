@@ -25,6 +25,7 @@
 #include <string>
 
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -183,9 +184,11 @@ class FakeCallTracer final : public CallTracerInterface {
 
 grpc_slice EncodeHeaderIntoBytes(
     bool is_eof,
-    const std::vector<std::pair<std::string, std::string>>& header_fields) {
+    const std::vector<std::pair<std::string, std::string>>& header_fields,
+    bool huffman_encode_values = false) {
   std::unique_ptr<grpc_core::HPackCompressor> compressor =
       std::make_unique<grpc_core::HPackCompressor>();
+  compressor->SetHuffmanEncodeValues(huffman_encode_values);
   grpc_metadata_batch b;
 
   for (const auto& field : header_fields) {
@@ -217,8 +220,10 @@ grpc_slice EncodeHeaderIntoBytes(
 // hexstring passed in
 static void verify(
     bool is_eof, const char* expected,
-    const std::vector<std::pair<std::string, std::string>>& header_fields) {
-  const grpc_core::Slice merged(EncodeHeaderIntoBytes(is_eof, header_fields));
+    const std::vector<std::pair<std::string, std::string>>& header_fields,
+    bool huffman_encode_values = false) {
+  const grpc_core::Slice merged(
+      EncodeHeaderIntoBytes(is_eof, header_fields, huffman_encode_values));
   const grpc_core::Slice expect(grpc_core::ParseHexstring(expected));
 
   EXPECT_EQ(merged, expect);
@@ -235,6 +240,110 @@ TEST(HpackEncoderTest, TestBasicHeaders) {
   delete g_compressor;
 }
 
+TEST(HpackEncoderTest, TestHuffmanEncodedValues) {
+  grpc_core::ExecCtx exec_ctx;
+
+  // Values that would not shrink are still sent as plain literals.
+  verify(false, "000005 0104 deadbeef 00 0161 0161", {{"a", "a"}}, true);
+  verify(false, "000010 0104 deadbeef 00 0161 8c f1e3c2e5f23a6ba0ab90f4ff",
+         {{"a", "www.example.com"}}, true);
+}
+
+static grpc_core::Slice EncodeWithCompressor(
+    grpc_core::HPackCompressor* compressor, absl::string_view key,
+    absl::string_view value) {
+  grpc_metadata_batch b;
+  b.Append(key, grpc_core::Slice::FromCopiedString(value),
+           CrashOnAppendError);
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_core::HPackCompressor::EncodeHeaderOptions hopt{
+      0xdeadbeef,  // stream_id
+      false,       // is_eof
+      false,       // use_true_binary_metadata
+      16384,       // max_frame_size
+      &call_tracer};
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  compressor->EncodeHeaders(hopt, b, &output);
+  grpc_core::Slice merged(grpc_slice_merge(output.slices, output.count));
+  grpc_slice_buffer_destroy(&output);
+  return merged;
+}
+
+TEST(HpackEncoderTest, WarmStartIndexesPairsRepeatedOnEarlierConnections) {
+  grpc_core::ExecCtx exec_ctx;
+  auto cache = grpc_core::MakeRefCounted<grpc_core::HPackWarmStartCache>();
+  const grpc_core::Slice unindexed(
+      grpc_core::ParseHexstring("000009 0104 deadbeef 00 016b 0576616c7565"));
+  const grpc_core::Slice inc_indexed(
+      grpc_core::ParseHexstring("000009 0104 deadbeef 40 016b 0576616c7565"));
+  const grpc_core::Slice indexed(
+      grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+
+  // The first connection only indexes the pair once it repeats.
+  auto compressor = std::make_unique<grpc_core::HPackCompressor>();
+  compressor->EnableWarmStart(cache, 8, {"k"});
+  EXPECT_EQ(EncodeWithCompressor(compressor.get(), "k", "value"), unindexed);
+  EXPECT_EQ(EncodeWithCompressor(compressor.get(), "k", "value"),
+            inc_indexed);
+  EXPECT_EQ(EncodeWithCompressor(compressor.get(), "k", "value"), indexed);
+  EXPECT_EQ(EncodeWithCompressor(compressor.get(), "k", "once"),
+            grpc_core::Slice(grpc_core::ParseHexstring(
+                "000008 0104 deadbeef 00 016b 046f6e6365")));
+  compressor.reset();
+  EXPECT_EQ(cache->Get(),
+            grpc_core::HPackWarmStartCache::HeaderPairs({{"k", "value"}}));
+
+  // The next one indexes it from its first use.
+  compressor = std::make_unique<grpc_core::HPackCompressor>();
+  compressor->EnableWarmStart(cache, 8, {"k"});
+  EXPECT_EQ(EncodeWithCompressor(compressor.get(), "k", "value"),
+            inc_indexed);
+  EXPECT_EQ(EncodeWithCompressor(compressor.get(), "k", "value"), indexed);
+}
+
+TEST(HpackEncoderTest, WarmStartOnlyTracksAllowedKeys) {
+  grpc_core::ExecCtx exec_ctx;
+  auto cache = grpc_core::MakeRefCounted<grpc_core::HPackWarmStartCache>();
+  cache->Update({{"k", "value"}, {"secret", "value"}});
+  const grpc_core::Slice unindexed(grpc_core::ParseHexstring(
+      "00000e 0104 deadbeef 00 06736563726574 0576616c7565"));
+
+  auto compressor = std::make_unique<grpc_core::HPackCompressor>();
+  compressor->EnableWarmStart(cache, 8, {"k"});
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(EncodeWithCompressor(compressor.get(), "secret", "value"),
+              unindexed);
+  }
+  EXPECT_EQ(EncodeWithCompressor(compressor.get(), "k", "value"),
+            grpc_core::Slice(grpc_core::ParseHexstring(
+                "000009 0104 deadbeef 40 016b 0576616c7565")));
+  EXPECT_EQ(EncodeWithCompressor(compressor.get(), "k", "value"),
+            grpc_core::Slice(
+                grpc_core::ParseHexstring("000001 0104 deadbeef be")));
+  compressor.reset();
+  EXPECT_EQ(cache->Get(),
+            grpc_core::HPackWarmStartCache::HeaderPairs({{"k", "value"}}));
+}
+
+TEST(HpackEncoderTest, WarmStartEvictsLeastRecentlyUsedTargets) {
+  auto first = grpc_core::HPackWarmStartCache::ForTarget("lru:first");
+  auto second = grpc_core::HPackWarmStartCache::ForTarget("lru:second");
+  EXPECT_EQ(grpc_core::HPackWarmStartCache::ForTarget("lru:first"), first);
+  // Enough other targets to evict every target not used since.
+  for (int i = 0; i < 2048; ++i) {
+    if (i % 100 == 0) {
+      EXPECT_EQ(grpc_core::HPackWarmStartCache::ForTarget("lru:first"),
+                first);
+    }
+    EXPECT_NE(
+        grpc_core::HPackWarmStartCache::ForTarget(absl::StrCat("lru:", i)),
+        nullptr);
+  }
+  EXPECT_EQ(grpc_core::HPackWarmStartCache::ForTarget("lru:first"), first);
+  EXPECT_NE(grpc_core::HPackWarmStartCache::ForTarget("lru:second"), second);
+}
+
 MATCHER(HasLiteralHeaderFieldNewNameFlagIncrementalIndexing, "") {
   constexpr size_t kHttp2FrameHeaderSize = 9u;
   /// Reference: https://httpwg.org/specs/rfc7541.html#rfc.section.6.2.1
@@ -0,0 +1,180 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/timer_manager.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.h"
+#include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.pb.h"
+#include "test/core/test_util/mock_endpoint.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::FuzzingEventEngine;
+using grpc_event_engine::experimental::MockEndpointController;
+
+constexpr auto kWindow = std::chrono::seconds(1);
+constexpr int kCoalescingBytes = 1024;
+
+class WriteCoalescingTest : public ::testing::Test {
+ protected:
+  WriteCoalescingTest() {
+    grpc_timer_manager_set_threading(false);
+    event_engine_ = std::make_shared<FuzzingEventEngine>(
+        FuzzingEventEngine::Options(), fuzzing_event_engine::Actions());
+    mock_endpoint_controller_ = MockEndpointController::Create(event_engine_);
+    args_ = args_.SetObject(ResourceQuota::Default());
+    args_ = args_.SetObject<EventEngine>(event_engine_);
+    args_ = args_.Set(
+        GRPC_ARG_HTTP2_WRITE_COALESCING_WINDOW_US,
+        static_cast<int>(
+            std::chrono::duration_cast<std::chrono::microseconds>(kWindow)
+                .count()));
+    args_ = args_.Set(GRPC_ARG_HTTP2_WRITE_COALESCING_BYTES, kCoalescingBytes);
+  }
+
+  ~WriteCoalescingTest() override {
+    mock_endpoint_controller_->NoMoreReads();
+    event_engine_->FuzzingDone();
+    event_engine_->TickUntilIdle();
+    event_engine_->UnsetGlobalHooks();
+  }
+
+  // Creates a client transport and waits for its initial write to finish.
+  grpc_chttp2_transport* CreateTransport() {
+    auto* t =
+        reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+            args_,
+            OrphanablePtr<grpc_endpoint>(
+                mock_endpoint_controller_->TakeCEndpoint()),
+            /*is_client=*/true));
+    ExecCtx::Get()->Flush();
+    event_engine_->TickForDuration(std::chrono::milliseconds(10));
+    EXPECT_EQ(t->write_state, GRPC_CHTTP2_WRITE_STATE_IDLE);
+    return t;
+  }
+
+  // Runs f under the transport's combiner.
+  template <typename F>
+  void RunLocked(grpc_chttp2_transport* t, F f) {
+    t->combiner->Run(NewClosure([&f](grpc_error_handle) { f(); }),
+                     absl::OkStatus());
+    ExecCtx::Get()->Flush();
+  }
+
+  void InitiateWrite(grpc_chttp2_transport* t,
+                     grpc_chttp2_initiate_write_reason reason) {
+    RunLocked(t, [t, reason]() { grpc_chttp2_initiate_write(t, reason); });
+  }
+
+  static bool WriteHeld(grpc_chttp2_transport* t) {
+    return t->write_coalescing_timer_handle !=
+           EventEngine::TaskHandle::kInvalid;
+  }
+
+  std::shared_ptr<FuzzingEventEngine> event_engine_;
+  std::shared_ptr<MockEndpointController> mock_endpoint_controller_;
+  ChannelArgs args_;
+};
+
+TEST_F(WriteCoalescingTest, HoldsStreamDataWrite) {
+  ExecCtx exec_ctx;
+  grpc_chttp2_transport* t = CreateTransport();
+  InitiateWrite(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+  EXPECT_TRUE(WriteHeld(t));
+  EXPECT_EQ(t->write_state, GRPC_CHTTP2_WRITE_STATE_WRITING);
+  // Another stream's write joins the held one.
+  InitiateWrite(t, GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM);
+  EXPECT_TRUE(WriteHeld(t));
+  EXPECT_EQ(t->write_coalescing_requests, 2);
+  // Control frames are not held.
+  InitiateWrite(t, GRPC_CHTTP2_INITIATE_WRITE_APPLICATION_PING);
+  EXPECT_FALSE(WriteHeld(t));
+  EXPECT_EQ(t->write_coalescing_requests, 0);
+  t->Orphan();
+}
+
+TEST_F(WriteCoalescingTest, ByteThresholdFlushesHeldWrite) {
+  ExecCtx exec_ctx;
+  grpc_chttp2_transport* t = CreateTransport();
+  InitiateWrite(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+  ASSERT_TRUE(WriteHeld(t));
+  RunLocked(t, [t]() {
+    t->write_coalescing_pending_bytes = kCoalescingBytes;
+    grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+  });
+  EXPECT_FALSE(WriteHeld(t));
+  // The flushed write had nothing to send.
+  EXPECT_EQ(t->write_state, GRPC_CHTTP2_WRITE_STATE_IDLE);
+  EXPECT_EQ(t->write_coalescing_pending_bytes, 0);
+  t->Orphan();
+}
+
+TEST_F(WriteCoalescingTest, TimerFlushesHeldWrite) {
+  ExecCtx exec_ctx;
+  grpc_chttp2_transport* t = CreateTransport();
+  InitiateWrite(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+  ASSERT_TRUE(WriteHeld(t));
+  event_engine_->TickForDuration(kWindow / 2);
+  EXPECT_TRUE(WriteHeld(t));
+  event_engine_->TickForDuration(kWindow);
+  ExecCtx::Get()->Flush();
+  EXPECT_FALSE(WriteHeld(t));
+  EXPECT_EQ(t->write_state, GRPC_CHTTP2_WRITE_STATE_IDLE);
+  t->Orphan();
+}
+
+TEST_F(WriteCoalescingTest, CloseFlushesHeldWrite) {
+  ExecCtx exec_ctx;
+  grpc_chttp2_transport* t = CreateTransport();
+  RefCountedPtr<grpc_chttp2_transport> ref = t->Ref();
+  InitiateWrite(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+  ASSERT_TRUE(WriteHeld(t));
+  t->Orphan();
+  ExecCtx::Get()->Flush();
+  // The transport closes without waiting out the window.
+  EXPECT_FALSE(WriteHeld(t));
+  EXPECT_EQ(t->write_state, GRPC_CHTTP2_WRITE_STATE_IDLE);
+  EXPECT_FALSE(t->closed_with_error.ok());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -33,6 +33,7 @@
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/interned_slice.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "test/core/test_util/test_config.h"
@@ -148,6 +149,24 @@ TEST(MetadataMapTest, NonTraitKeyWithMultipleValues) {
   EXPECT_EQ(map.GetStringValue(kKey, &buffer), "value1,value2");
 }
 
+TEST(MetadataMapTest, OversizedUnknownKeysAreNotInterned) {
+  TimeoutOnlyMetadataMap map;
+  const size_t interned = InternedSliceTable::Global().size();
+  for (int i = 0; i < 100; i++) {
+    const std::string key =
+        absl::StrCat("x-", std::string(InternedSliceTable::kMaxInternedLength,
+                                       'k'),
+                     i);
+    map.Append(key, Slice::FromStaticString("value"),
+               [](absl::string_view error, const Slice& value) {
+                 LOG(ERROR) << error << " value:" << value.as_string_view();
+               });
+    std::string buffer;
+    EXPECT_EQ(map.GetStringValue(key, &buffer), "value");
+  }
+  EXPECT_EQ(InternedSliceTable::Global().size(), interned);
+}
+
 TEST(DebugStringBuilderTest, OneAddAfterRedaction) {
   metadata_detail::DebugStringBuilder b;
   b.AddAfterRedaction(ContentTypeMetadata::key(), "AddValue01");
@@ -169,6 +188,7 @@ std::vector<std::string> GetAllowList() {
           std::string(GrpcRetryPushbackMsMetadata::key()),
           std::string(GrpcServerStatsBinMetadata::key()),
           std::string(GrpcStatusMetadata::key()),
+          std::string(GrpcStreamCompressionMetadata::key()),
           std::string(GrpcTagsBinMetadata::key()),
           std::string(GrpcTimeoutMetadata::key()),
           std::string(GrpcTraceBinMetadata::key()),
@@ -274,6 +294,7 @@ std::vector<std::string> GetEncodableHeaders() {
           std::string(GrpcRetryPushbackMsMetadata::key()),
           std::string(GrpcServerStatsBinMetadata::key()),
           std::string(GrpcStatusMetadata::key()),
+          std::string(GrpcStreamCompressionMetadata::key()),
           std::string(GrpcTagsBinMetadata::key()),
           std::string(GrpcTimeoutMetadata::key()),
           std::string(GrpcTraceBinMetadata::key()),
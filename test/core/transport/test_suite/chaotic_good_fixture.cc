@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <memory>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "gmock/gmock.h"
@@ -116,4 +117,34 @@ TRANSPORT_FIXTURE(ChaoticGood) {
                                       std::move(server_transport)};
 }
 
+TRANSPORT_FIXTURE(ChaoticGoodStriped) {
+  auto resource_quota = MakeResourceQuota("test");
+  EndpointPair control_endpoints =
+      CreateEndpointPair(event_engine.get(), resource_quota, 1234);
+  std::vector<PromiseEndpoint> client_data_endpoints;
+  std::vector<PromiseEndpoint> server_data_endpoints;
+  for (int i = 0; i < 3; i++) {
+    EndpointPair data_endpoints =
+        CreateEndpointPair(event_engine.get(), resource_quota, 4321 + i);
+    client_data_endpoints.push_back(std::move(data_endpoints.client));
+    server_data_endpoints.push_back(std::move(data_endpoints.server));
+  }
+  auto channel_args =
+      ChannelArgs()
+          .SetObject(resource_quota)
+          .SetObject(std::static_pointer_cast<EventEngine>(event_engine));
+  auto client_transport =
+      MakeOrphanable<chaotic_good::ChaoticGoodClientTransport>(
+          std::move(control_endpoints.client), std::move(client_data_endpoints),
+          ChannelArgs().SetObject(resource_quota), event_engine, HPackParser(),
+          HPackCompressor());
+  auto server_transport =
+      MakeOrphanable<chaotic_good::ChaoticGoodServerTransport>(
+          channel_args, std::move(control_endpoints.server),
+          std::move(server_data_endpoints), event_engine, HPackParser(),
+          HPackCompressor());
+  return ClientAndServerTransportPair{std::move(client_transport),
+                                      std::move(server_transport)};
+}
+
 }  // namespace grpc_core
@@ -0,0 +1,159 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/latent_see.h"
+
+#include <string>
+
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+namespace latent_see {
+namespace {
+
+#ifdef GRPC_ENABLE_LATENT_SEE
+
+bool HasEvent(const std::string& json, absl::string_view name,
+              absl::string_view phase) {
+  return absl::StrContains(json, absl::StrCat("{\"name\": \"", name,
+                                              "\", \"ph\": \"", phase, "\""));
+}
+
+class LatentSeeTest : public ::testing::Test {
+ protected:
+  LatentSeeTest() {
+    SetEnabled(true);
+    SetCallSampleRate(1);
+    // Drop whatever earlier tests recorded.
+    ExportJson();
+  }
+  ~LatentSeeTest() override {
+    SetEnabled(true);
+    SetCallSampleRate(1);
+  }
+};
+
+TEST_F(LatentSeeTest, ExportsRecordedScopesAsTraceEvents) {
+  {
+    GRPC_LATENT_SEE_PARENT_SCOPE("parent");
+    {
+      GRPC_LATENT_SEE_INNER_SCOPE("inner");
+      GRPC_LATENT_SEE_MARK("mark");
+    }
+  }
+  const std::string json = ExportJson();
+  EXPECT_TRUE(HasEvent(json, "parent", "B")) << json;
+  EXPECT_TRUE(HasEvent(json, "parent", "E")) << json;
+  EXPECT_TRUE(HasEvent(json, "inner", "B")) << json;
+  EXPECT_TRUE(HasEvent(json, "inner", "E")) << json;
+  EXPECT_TRUE(HasEvent(json, "mark", "i")) << json;
+  // Exporting drains the log.
+  EXPECT_EQ(ExportJson(), "[]");
+}
+
+TEST_F(LatentSeeTest, InnerScopeOutsideParentScopeRecordsNothing) {
+  { GRPC_LATENT_SEE_INNER_SCOPE("inner"); }
+  EXPECT_EQ(ExportJson(), "[]");
+}
+
+TEST_F(LatentSeeTest, DisabledRecordsNothing) {
+  SetEnabled(false);
+  EXPECT_FALSE(IsEnabled());
+  {
+    GRPC_LATENT_SEE_PARENT_SCOPE("parent");
+    { GRPC_LATENT_SEE_INNER_SCOPE("inner"); }
+  }
+  EXPECT_EQ(ExportJson(), "[]");
+  SetEnabled(true);
+  EXPECT_TRUE(IsEnabled());
+  { GRPC_LATENT_SEE_PARENT_SCOPE("parent"); }
+  EXPECT_TRUE(HasEvent(ExportJson(), "parent", "B"));
+}
+
+TEST_F(LatentSeeTest, CallSampleFollowsSampleRate) {
+  auto count_sampled = [](int calls) {
+    int sampled = 0;
+    for (int i = 0; i < calls; i++) {
+      if (CallSample().sampled()) sampled++;
+    }
+    return sampled;
+  };
+  EXPECT_EQ(count_sampled(9), 9);
+  SetCallSampleRate(3);
+  EXPECT_EQ(count_sampled(9), 3);
+  SetCallSampleRate(0);
+  EXPECT_EQ(count_sampled(9), 0);
+  SetCallSampleRate(1);
+  SetEnabled(false);
+  EXPECT_EQ(count_sampled(9), 0);
+}
+
+TEST_F(LatentSeeTest, UnsampledScopeSuspendsEnclosingScope) {
+  {
+    GRPC_LATENT_SEE_PARENT_SCOPE("outer");
+    {
+      GRPC_LATENT_SEE_PARENT_SCOPE_IF(false, "unsampled");
+      {
+        GRPC_LATENT_SEE_INNER_SCOPE("hidden");
+        GRPC_LATENT_SEE_MARK("hidden_mark");
+      }
+    }
+    { GRPC_LATENT_SEE_INNER_SCOPE("visible"); }
+  }
+  const std::string json = ExportJson();
+  EXPECT_TRUE(HasEvent(json, "outer", "B")) << json;
+  EXPECT_TRUE(HasEvent(json, "outer", "E")) << json;
+  EXPECT_TRUE(HasEvent(json, "visible", "B")) << json;
+  EXPECT_FALSE(absl::StrContains(json, "unsampled")) << json;
+  EXPECT_FALSE(absl::StrContains(json, "hidden")) << json;
+}
+
+TEST_F(LatentSeeTest, SampledScopeRecords) {
+  {
+    GRPC_LATENT_SEE_PARENT_SCOPE_IF(CallSample().sampled(), "sampled");
+  }
+  EXPECT_TRUE(HasEvent(ExportJson(), "sampled", "B"));
+}
+
+#else  // !GRPC_ENABLE_LATENT_SEE
+
+TEST(LatentSeeTest, RuntimeControlsAreNoOps) {
+  SetEnabled(true);
+  EXPECT_FALSE(IsEnabled());
+  SetCallSampleRate(1);
+  EXPECT_FALSE(CallSample().sampled());
+  { GRPC_LATENT_SEE_PARENT_SCOPE("parent"); }
+  EXPECT_EQ(ExportJson(), "[]");
+}
+
+#endif  // GRPC_ENABLE_LATENT_SEE
+
+}  // namespace
+}  // namespace latent_see
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+#ifdef GRPC_ENABLE_LATENT_SEE
+  // Don't write latent_see.json at exit.
+  grpc_core::latent_see::Log::Get().OverrideStatsFlusher(
+      [](absl::string_view) {});
+#endif
+  return RUN_ALL_TESTS();
+}
@@ -20,6 +20,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <grpc/support/alloc.h>
+
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/test_util/test_config.h"
@@ -60,6 +62,39 @@ static void BM_Arena_Batch(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_Batch)->Ranges({{1, 64 * 1024}, {1, 64}, {1, 1024}});
 
+// Arena lifetime as seen by a unary call: create from a factory whose size
+// estimate covers the call, make a handful of small allocations, destroy.
+static void BM_Arena_CallChurn(benchmark::State& state) {
+  auto factory = grpc_core::SimpleArenaAllocator(state.range(0));
+  for (auto _ : state) {
+    auto a = factory->MakeArena();
+    for (int i = 0; i < 8; i++) {
+      benchmark::DoNotOptimize(a->Alloc(64));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Arena_CallChurn)
+    ->RangeMultiplier(4)
+    ->Range(1024, 64 * 1024)
+    ->ThreadRange(1, 8);
+
+// What BM_Arena_CallChurn costs on top of the arena bookkeeping when each
+// call's initial zone comes from malloc instead of the zone pool.
+static void BM_Arena_CallChurnMallocBaseline(benchmark::State& state) {
+  const size_t size = state.range(0);
+  for (auto _ : state) {
+    void* p = gpr_malloc_aligned(size, grpc_core::ArenaZonePool::kAlignment);
+    benchmark::DoNotOptimize(p);
+    gpr_free_aligned(p);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Arena_CallChurnMallocBaseline)
+    ->RangeMultiplier(4)
+    ->Range(1024, 64 * 1024)
+    ->ThreadRange(1, 8);
+
 struct TestThingToAllocate {
   int a;
   int b;
@@ -20,7 +20,9 @@
 #include <benchmark/benchmark.h>
 
 #include "absl/container/btree_map.h"
+#include "absl/strings/str_cat.h"
 
+#include <grpc/impl/channel_arg_names.h>
 #include <grpcpp/support/channel_arguments.h>
 
 #include "src/core/lib/channel/channel_args.h"
@@ -82,6 +84,65 @@ void BM_ChannelArgsAsKeyIntoBTree(benchmark::State& state) {
 }
 BENCHMARK(BM_ChannelArgsAsKeyIntoBTree);
 
+// Args resembling those of a subchannel: a couple of dozen entries, few of
+// them well known.
+grpc_core::ChannelArgs TypicalArgs(int variant) {
+  grpc_core::ChannelArgs args;
+  for (int i = 0; i < 20; i++) {
+    args = args.Set(absl::StrCat("grpc.internal.arg_", i), i);
+  }
+  return args.Set(GRPC_ARG_PRIMARY_USER_AGENT_STRING, "bm")
+      .Set("grpc.internal.variant", variant);
+}
+
+void BM_ChannelArgsGetUnsetByName(benchmark::State& state) {
+  const auto args = TypicalArgs(0);
+  for (auto s : state) {
+    benchmark::DoNotOptimize(args.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
+  }
+}
+BENCHMARK(BM_ChannelArgsGetUnsetByName);
+
+void BM_ChannelArgsGetUnsetWellKnown(benchmark::State& state) {
+  static constexpr grpc_core::WellKnownChannelArg kKeepaliveTime(
+      GRPC_ARG_KEEPALIVE_TIME_MS);
+  const auto args = TypicalArgs(0);
+  for (auto s : state) {
+    benchmark::DoNotOptimize(args.GetInt(kKeepaliveTime));
+  }
+}
+BENCHMARK(BM_ChannelArgsGetUnsetWellKnown);
+
+void BM_ChannelArgsGetSetWellKnown(benchmark::State& state) {
+  static constexpr grpc_core::WellKnownChannelArg kUserAgent(
+      GRPC_ARG_PRIMARY_USER_AGENT_STRING);
+  const auto args = TypicalArgs(0);
+  for (auto s : state) {
+    benchmark::DoNotOptimize(args.GetString(kUserAgent));
+  }
+}
+BENCHMARK(BM_ChannelArgsGetSetWellKnown);
+
+// Separately built args differing in one value, as when comparing subchannel
+// keys: the hash tells them apart without walking both trees.
+void BM_ChannelArgsCompareUnequal(benchmark::State& state) {
+  const auto a = TypicalArgs(1);
+  const auto b = TypicalArgs(2);
+  for (auto s : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+BENCHMARK(BM_ChannelArgsCompareUnequal);
+
+void BM_ChannelArgsCompareEqual(benchmark::State& state) {
+  const auto a = TypicalArgs(1);
+  const auto b = TypicalArgs(1);
+  for (auto s : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+BENCHMARK(BM_ChannelArgsCompareEqual);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
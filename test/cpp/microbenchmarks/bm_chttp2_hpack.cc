@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <sstream>
+#include <string>
 
 #include <benchmark/benchmark.h>
 
@@ -142,6 +143,7 @@ static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
   Fixture::Prepare(&b);
 
   grpc_core::HPackCompressor c;
+  c.SetHuffmanEncodeValues(Fixture::kHuffmanEncodeValues);
   grpc_core::FakeCallTracer call_tracer;
   grpc_slice_buffer outbuf;
   grpc_slice_buffer_init(&outbuf);
@@ -175,12 +177,14 @@ namespace hpack_encoder_fixtures {
 class EmptyBatch {
  public:
   static constexpr bool kEnableTrueBinary = false;
+  static constexpr bool kHuffmanEncodeValues = false;
   static void Prepare(grpc_metadata_batch*) {}
 };
 
 class SingleStaticElem {
  public:
   static constexpr bool kEnableTrueBinary = false;
+  static constexpr bool kHuffmanEncodeValues = false;
   static void Prepare(grpc_metadata_batch* b) {
     b->Set(grpc_core::GrpcAcceptEncodingMetadata(),
            grpc_core::CompressionAlgorithmSet(
@@ -195,6 +199,7 @@ static void CrashOnAppendError(absl::string_view, const grpc_core::Slice&) {
 class SingleNonBinaryElem {
  public:
   static constexpr bool kEnableTrueBinary = false;
+  static constexpr bool kHuffmanEncodeValues = false;
   static void Prepare(grpc_metadata_batch* b) {
     b->Append("abc", grpc_core::Slice::FromStaticString("def"),
               CrashOnAppendError);
@@ -205,6 +210,7 @@ template <int kLength, bool kTrueBinary>
 class SingleBinaryElem {
  public:
   static constexpr bool kEnableTrueBinary = kTrueBinary;
+  static constexpr bool kHuffmanEncodeValues = false;
   static void Prepare(grpc_metadata_batch* b) {
     b->Append("abc-bin", MakeBytes(), CrashOnAppendError);
   }
@@ -223,6 +229,7 @@ class SingleBinaryElem {
 class RepresentativeClientInitialMetadata {
  public:
   static constexpr bool kEnableTrueBinary = true;
+  static constexpr bool kHuffmanEncodeValues = false;
   static void Prepare(grpc_metadata_batch* b) {
     b->Set(grpc_core::HttpSchemeMetadata(),
            grpc_core::HttpSchemeMetadata::kHttp);
@@ -253,6 +260,7 @@ class RepresentativeClientInitialMetadata {
 class MoreRepresentativeClientInitialMetadata {
  public:
   static constexpr bool kEnableTrueBinary = true;
+  static constexpr bool kHuffmanEncodeValues = false;
   static void Prepare(grpc_metadata_batch* b) {
     b->Set(grpc_core::HttpSchemeMetadata(),
            grpc_core::HttpSchemeMetadata::kHttp);
@@ -291,9 +299,50 @@ class MoreRepresentativeClientInitialMetadata {
   }
 };
 
+// Initial metadata as forwarded by an edge proxy: a long bearer token and B3
+// tracing headers. None of these are known to the encoder, so they are sent as
+// literals on every call.
+template <bool kHuffman>
+class EdgeProxyClientInitialMetadata {
+ public:
+  static constexpr bool kEnableTrueBinary = true;
+  static constexpr bool kHuffmanEncodeValues = kHuffman;
+  static void Prepare(grpc_metadata_batch* b) {
+    RepresentativeClientInitialMetadata::Prepare(b);
+    b->Append("authorization",
+              grpc_core::Slice::FromCopiedString(MakeBearerToken()),
+              CrashOnAppendError);
+    b->Append("x-b3-traceid",
+              grpc_core::Slice::FromStaticString(
+                  "463ac35c9f6413ad48485a3953bb6124"),
+              CrashOnAppendError);
+    b->Append("x-b3-spanid",
+              grpc_core::Slice::FromStaticString("a2fb4a1d1a96d312"),
+              CrashOnAppendError);
+    b->Append("x-b3-parentspanid",
+              grpc_core::Slice::FromStaticString("0020000000000001"),
+              CrashOnAppendError);
+    b->Append("x-b3-sampled", grpc_core::Slice::FromStaticString("1"),
+              CrashOnAppendError);
+  }
+
+ private:
+  // A JWT sized token drawn from the base64url alphabet.
+  static std::string MakeBearerToken() {
+    static const char kAlphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    std::string token = "Bearer ";
+    for (int i = 0; i < 800; i++) {
+      token.push_back(kAlphabet[rand() % 64]);
+    }
+    return token;
+  }
+};
+
 class RepresentativeServerInitialMetadata {
  public:
   static constexpr bool kEnableTrueBinary = true;
+  static constexpr bool kHuffmanEncodeValues = false;
   static void Prepare(grpc_metadata_batch* b) {
     b->Set(grpc_core::HttpStatusMetadata(), 200);
     b->Set(grpc_core::ContentTypeMetadata(),
@@ -308,6 +357,7 @@ class RepresentativeServerInitialMetadata {
 class RepresentativeServerTrailingMetadata {
  public:
   static constexpr bool kEnableTrueBinary = true;
+  static constexpr bool kHuffmanEncodeValues = false;
   static void Prepare(grpc_metadata_batch* b) {
     b->Set(grpc_core::GrpcStatusMetadata(), GRPC_STATUS_OK);
   }
@@ -340,6 +390,12 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    MoreRepresentativeClientInitialMetadata)
     ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   EdgeProxyClientInitialMetadata<false>)
+    ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   EdgeProxyClientInitialMetadata<true>)
+    ->Args({0, 16384});
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    RepresentativeServerInitialMetadata)
     ->Args({0, 16384});
@@ -21,6 +21,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multisym.h"
 #include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/slice/slice.h"
 #include "test/core/test_util/test_config.h"
@@ -85,6 +86,8 @@ static void BM_Decode(benchmark::State& state, CharSet chars_gen) {
   BENCHMARK_CAPTURE(name, alpha_chars, AlphaChars)
 
 DECL_HUFFMAN_VARIANTS();
+DECL_BENCHMARK(grpc_core::HuffDecoder, Generated);
+DECL_BENCHMARK(grpc_core::MultiSymHuffDecoder, MultiSym);
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
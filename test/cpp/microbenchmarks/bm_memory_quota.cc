@@ -0,0 +1,84 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Contention on a memory quota shared by many threads, each with its own
+// allocators, as happens with many channels on a big machine.
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+grpc_core::MemoryQuota* SharedQuota() {
+  static grpc_core::MemoryQuota* quota = [] {
+    auto* quota = new grpc_core::MemoryQuota("bm_memory_quota");
+    quota->SetSize(size_t{1} << 32);
+    return quota;
+  }();
+  return quota;
+}
+
+// An allocator per iteration: creating and destroying it takes from and
+// returns to the quota, as does the reservation it makes.
+void BM_MemoryQuota_AllocatorChurn(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::MemoryQuota* quota = SharedQuota();
+  for (auto _ : state) {
+    auto allocator = quota->CreateMemoryAllocator("churn");
+    allocator.Release(allocator.Reserve(state.range(0)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MemoryQuota_AllocatorChurn)
+    ->Range(1024, 256 * 1024)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+// One long lived allocator per thread, making reservations large enough
+// that each one goes back to the quota.
+void BM_MemoryQuota_LargeReservations(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  auto allocator = SharedQuota()->CreateMemoryAllocator("large");
+  for (auto _ : state) {
+    allocator.Release(allocator.Reserve(state.range(0)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MemoryQuota_LargeReservations)
+    ->Range(64 * 1024, 1024 * 1024)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
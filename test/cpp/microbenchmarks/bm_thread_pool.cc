@@ -12,8 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -26,7 +29,9 @@
 #include <grpcpp/impl/grpc_library.h>
 
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/notification.h"
 #include "src/core/util/useful.h"
@@ -38,7 +43,9 @@ namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::NumaTopology;
 using ::grpc_event_engine::experimental::ThreadPool;
+using ::grpc_event_engine::experimental::WorkStealingThreadPool;
 
 struct FanoutParameters {
   int depth;
@@ -241,6 +248,84 @@ void BM_ThreadPool_Closure_FanOut(benchmark::State& state) {
 }
 BENCHMARK(BM_ThreadPool_Closure_FanOut)->Apply(FanoutTestArguments);
 
+// Connection affine work: many chains of closures, each of which queues the
+// next link from the pool thread that ran it, the way an endpoint's read
+// callbacks do. Compares the flat pool with one split by NUMA node, reporting
+// the 99th percentile delay between Run and the closure starting. On hosts
+// with a single node the NUMA pool uses two synthetic nodes.
+enum class PoolTopology { kFlat, kNuma };
+
+struct AffineChains {
+  static constexpr int kLength = 16;
+
+  AffineChains(ThreadPool* pool, int num_chains)
+      : pool(pool), delays_ns(num_chains * kLength), remaining(num_chains) {}
+
+  ThreadPool* const pool;
+  std::vector<int64_t> delays_ns;
+  std::atomic<int> remaining;
+  grpc_core::Notification done;
+};
+
+void RunChainLink(AffineChains* chains, int chain, int link,
+                  std::chrono::steady_clock::time_point queued) {
+  auto now = std::chrono::steady_clock::now();
+  chains->delays_ns[chain * AffineChains::kLength + link] =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now - queued)
+          .count();
+  if (link + 1 < AffineChains::kLength) {
+    chains->pool->Run([chains, chain, link, now]() {
+      RunChainLink(chains, chain, link + 1, now);
+    });
+    return;
+  }
+  if (chains->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    chains->done.Notify();
+  }
+}
+
+template <PoolTopology kTopology>
+void BM_ThreadPool_AffineChains(benchmark::State& state) {
+  NumaTopology topology = NumaTopology::Flat();
+  if (kTopology == PoolTopology::kNuma) {
+    topology = NumaTopology::Host().num_nodes() > 1
+                   ? NumaTopology::Host()
+                   : NumaTopology::Synthetic(2);
+  }
+  WorkStealingThreadPool pool(grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u),
+                              std::move(topology),
+                              /*pin_threads_to_nodes=*/false);
+  const int num_chains = state.range(0);
+  double p99_sum_us = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    AffineChains chains(&pool, num_chains);
+    state.ResumeTiming();
+    for (int i = 0; i < num_chains; i++) {
+      auto queued = std::chrono::steady_clock::now();
+      pool.Run([&chains, i, queued]() { RunChainLink(&chains, i, 0, queued); });
+    }
+    chains.done.WaitForNotification();
+    state.PauseTiming();
+    auto p99 = chains.delays_ns.begin() + chains.delays_ns.size() * 99 / 100;
+    std::nth_element(chains.delays_ns.begin(), p99, chains.delays_ns.end());
+    p99_sum_us += *p99 / 1000.0;
+    state.ResumeTiming();
+  }
+  state.counters["p99_us"] = p99_sum_us / state.iterations();
+  state.SetItemsProcessed(num_chains * AffineChains::kLength *
+                          state.iterations());
+  pool.Quiesce();
+}
+BENCHMARK_TEMPLATE(BM_ThreadPool_AffineChains, PoolTopology::kFlat)
+    ->Range(16, 1024)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPool_AffineChains, PoolTopology::kNuma)
+    ->Range(16, 1024)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
 }  // namespace
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
@@ -0,0 +1,110 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Arming and then cancelling many concurrent timers that never fire, the
+// common case for deadlines and keepalives, on the posix EventEngine's heap
+// based TimerList and on TimingWheelTimerList.
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/log/check.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timing_wheel.h"
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::Timer;
+using grpc_event_engine::experimental::TimerList;
+using grpc_event_engine::experimental::TimerListHost;
+using grpc_event_engine::experimental::TimingWheelTimerList;
+
+class FixedTimeHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  }
+  void Kick() override {}
+};
+
+class NoopClosure final : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+// Shared by all threads of a benchmark run.
+template <typename List>
+List* GetList() {
+  static FixedTimeHost host;
+  static List* list = new List(&host);
+  return list;
+}
+
+template <typename List>
+void BM_ArmCancel(benchmark::State& state) {
+  const size_t num_timers = state.range(0) / state.threads();
+  List* list = GetList<List>();
+  FixedTimeHost host;
+  std::vector<Timer> timers(num_timers);
+  NoopClosure closure;
+  for (auto _ : state) {
+    for (size_t i = 0; i < num_timers; i++) {
+      // Spread deadlines from a millisecond to a minute out.
+      list->TimerInit(&timers[i],
+                      host.Now() + grpc_core::Duration::Milliseconds(
+                                       1 + (i * 7919) % 60000),
+                      &closure);
+    }
+    for (size_t i = 0; i < num_timers; i++) {
+      CHECK(list->TimerCancel(&timers[i]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_timers);
+}
+BENCHMARK_TEMPLATE(BM_ArmCancel, TimerList)
+    ->Range(1024, 1 << 20)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ArmCancel, TimingWheelTimerList)
+    ->Range(1024, 1 << 20)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}